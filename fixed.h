@@ -10,11 +10,21 @@
 
 #include <cstdint>
 
+/// @brief Expands to constexpr when the language level supports constexpr functions with full statement bodies (C++14 and above). Functions marked with this fold at compile time under C++14 while remaining plain inline functions under C++11.
+#if __cplusplus >= 201402L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201402L)
+	#define CC0_FIXED_CONSTEXPR constexpr
+#else
+	#define CC0_FIXED_CONSTEXPR
+#endif
+
 namespace cc0
 {
 	/// @brief For internal use only.
 	namespace fixed_internal
 	{
+		/// @brief A tag type selecting the constructor that adopts a bit representation verbatim.
+		struct raw_bits {};
+
 		/// @brief Provides some type information for various integer types of specified bit sizes.
 		/// @tparam bits The number of bits to get integer information about.
 		template < uint32_t bits > struct intinfo {};
@@ -59,27 +69,241 @@ namespace cc0
 			typedef intinfo<64> next;   // The next, larger type info object (there is none, so we alias the same object).
 		};
 
+		/// @brief Multiplies two unsigned 64-bit numbers into a full 128-bit product represented as two 64-bit words.
+		/// @param a The left-hand side operand.
+		/// @param b The right-hand side operand.
+		/// @param hi The high 64 bits of the product.
+		/// @param lo The low 64 bits of the product.
+		inline void umul128(uint64_t a, uint64_t b, uint64_t &hi, uint64_t &lo)
+		{
+			const uint64_t a_lo = a & 0xffffffffu;
+			const uint64_t a_hi = a >> 32;
+			const uint64_t b_lo = b & 0xffffffffu;
+			const uint64_t b_hi = b >> 32;
+
+			const uint64_t p0 = a_lo * b_lo;
+			const uint64_t p1 = a_lo * b_hi;
+			const uint64_t p2 = a_hi * b_lo;
+			const uint64_t p3 = a_hi * b_hi;
+
+			const uint64_t carry = ((p0 >> 32) + (p1 & 0xffffffffu) + (p2 & 0xffffffffu)) >> 32;
+
+			lo = p0 + (p1 << 32) + (p2 << 32);
+			hi = p3 + (p1 >> 32) + (p2 >> 32) + carry;
+		}
+
+		/// @brief Multiplies two signed 64-bit numbers into a full 128-bit two's complement product represented as two 64-bit words.
+		/// @param a The left-hand side operand.
+		/// @param b The right-hand side operand.
+		/// @param hi The high 64 bits of the product.
+		/// @param lo The low 64 bits of the product.
+		inline void imul128(int64_t a, int64_t b, int64_t &hi, uint64_t &lo)
+		{
+			uint64_t uhi;
+			umul128(uint64_t(a), uint64_t(b), uhi, lo);
+			if (a < 0) { uhi -= uint64_t(b); }
+			if (b < 0) { uhi -= uint64_t(a); }
+			hi = int64_t(uhi);
+		}
+
+		/// @brief Multiplies two unsigned 64-bit numbers and returns the high 64 bits of the product from its four partial products. For internal use by umulhi.
+		/// @param p0 The low-low partial product.
+		/// @param p1 The low-high partial product.
+		/// @param p2 The high-low partial product.
+		/// @param p3 The high-high partial product.
+		/// @return The high 64 bits of the product.
+		constexpr uint64_t umulhi_comp(uint64_t p0, uint64_t p1, uint64_t p2, uint64_t p3)
+		{
+			return p3 + (p1 >> 32) + (p2 >> 32) + (((p0 >> 32) + (p1 & 0xffffffffu) + (p2 & 0xffffffffu)) >> 32);
+		}
+
+		/// @brief Multiplies two unsigned 64-bit numbers and returns the high 64 bits of the product. Unlike umul128 this is a single constant expression, so it can run at compile time under C++11.
+		/// @param a The left-hand side operand.
+		/// @param b The right-hand side operand.
+		/// @return The high 64 bits of the product.
+		constexpr uint64_t umulhi(uint64_t a, uint64_t b)
+		{
+			return umulhi_comp((a & 0xffffffffu) * (b & 0xffffffffu), (a & 0xffffffffu) * (b >> 32), (a >> 32) * (b & 0xffffffffu), (a >> 32) * (b >> 32));
+		}
+
+		/// @brief Counts the number of bits needed to represent a number.
+		/// @param x The number.
+		/// @return The number of bits, i.e. the position of the highest set bit plus one. Zero for zero.
+		constexpr uint32_t bit_width(uint64_t x)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return x != 0 ? uint32_t(64 - __builtin_clzll(x)) : 0;
+#else
+			return
+				(x >> 32) != 0 ? bit_width(x >> 32) + 32 :
+				(x >> 16) != 0 ? bit_width(x >> 16) + 16 :
+				(x >> 8)  != 0 ? bit_width(x >> 8)  + 8  :
+				(x >> 4)  != 0 ? bit_width(x >> 4)  + 4  :
+				(x >> 2)  != 0 ? bit_width(x >> 2)  + 2  :
+				(x >> 1)  != 0 ? 2 :
+				x != 0 ? 1 : 0;
+#endif
+		}
+
+		/// @brief The powers of ten up to 10^20, the largest exponent the fraction rescaler can request. The last entry wraps around the 64-bit range, matching what repeated multiplication produces.
+		static constexpr uint64_t POW10[21] = {
+			UINT64_C(1),
+			UINT64_C(10),
+			UINT64_C(100),
+			UINT64_C(1000),
+			UINT64_C(10000),
+			UINT64_C(100000),
+			UINT64_C(1000000),
+			UINT64_C(10000000),
+			UINT64_C(100000000),
+			UINT64_C(1000000000),
+			UINT64_C(10000000000),
+			UINT64_C(100000000000),
+			UINT64_C(1000000000000),
+			UINT64_C(10000000000000),
+			UINT64_C(100000000000000),
+			UINT64_C(1000000000000000),
+			UINT64_C(10000000000000000),
+			UINT64_C(100000000000000000),
+			UINT64_C(1000000000000000000),
+			UINT64_C(10000000000000000000),
+			UINT64_C(7766279631452241920)
+		};
+
+		/// @brief Round-up magic reciprocals ceil(2^(62 + bit_width(POW10[i])) / POW10[i]) for POW10[1] through POW10[20], so that division by a power of ten becomes a high multiply and a shift.
+		static constexpr uint64_t POW10_RECIP[20] = {
+			UINT64_C(7378697629483820647),
+			UINT64_C(5902958103587056518),
+			UINT64_C(4722366482869645214),
+			UINT64_C(7555786372591432342),
+			UINT64_C(6044629098073145874),
+			UINT64_C(4835703278458516699),
+			UINT64_C(7737125245533626719),
+			UINT64_C(6189700196426901375),
+			UINT64_C(4951760157141521100),
+			UINT64_C(7922816251426433760),
+			UINT64_C(6338253001141147008),
+			UINT64_C(5070602400912917606),
+			UINT64_C(8112963841460668170),
+			UINT64_C(6490371073168534536),
+			UINT64_C(5192296858534827629),
+			UINT64_C(8307674973655724206),
+			UINT64_C(6646139978924579365),
+			UINT64_C(5316911983139663492),
+			UINT64_C(8507059173023461587),
+			UINT64_C(5476920466893296043)
+		};
+
+		/// @brief The number of bits to shift the high product word down by for each entry in POW10_RECIP.
+		static constexpr uint32_t POW10_RECIP_SHIFT[20] = {
+			2, 5, 8, 12, 15, 18, 22, 25, 28, 32, 35, 38, 42, 45, 48, 52, 55, 58, 62, 61
+		};
+
+		/// @brief Corrects a magic-reciprocal quotient estimate down by one when the round-up multiplier overshoots. For internal use by div_pow10.
+		/// @param q The quotient estimate. At most one above the true quotient.
+		/// @param n The dividend.
+		/// @param p The divisor.
+		/// @return The exact quotient.
+		constexpr uint64_t div_pow10_fixup(uint64_t q, uint64_t n, uint64_t p)
+		{
+			return q - ((umulhi(q, p) != 0 || q * p > n) ? 1 : 0);
+		}
+
+		/// @brief Divides a number by a power of ten exactly, using a precomputed reciprocal multiply instead of a hardware divide.
+		/// @param n The dividend.
+		/// @param i The exponent of the power of ten. Must be between 1 and 20.
+		/// @return The quotient, identical to n / POW10[i].
+		constexpr uint64_t div_pow10(uint64_t n, uint32_t i)
+		{
+			return div_pow10_fixup(umulhi(n, POW10_RECIP[i - 1]) >> POW10_RECIP_SHIFT[i - 1], n, POW10[i]);
+		}
+
+		/// @brief Looks up a power of ten.
+		/// @param n The exponent.
+		/// @return 10^n for exponents up to 20, and 1 beyond that since callers form out-of-range exponents by wrapping unsigned arithmetic where exp would have seen a negative exponent.
+		constexpr uint64_t pow10(uint32_t n)
+		{
+			return n <= 20 ? POW10[n] : 1;
+		}
+
+		/// @brief Corrects a bit-width based log10 estimate down by one when the estimate overshoots. For internal use by log10.
+		/// @param est The estimate. At most one above the true result.
+		/// @param x The number.
+		/// @return The corrected result.
+		constexpr uint32_t log10_adjust(uint32_t est, uint64_t x)
+		{
+			return est - (x < POW10[est] ? 1 : 0);
+		}
+
 		/// @brief The log10.
 		/// @param x The number.
 		/// @return The result.
-		inline uint32_t log10(uint64_t x)
+		constexpr uint32_t log10(uint64_t x)
 		{
-			uint32_t n;
-			for (n = 0; x > 0; ++n, x /= 10) {}
-			return n - 1;
+			// bit_width(x) * 1233 >> 12 approximates bit_width(x) * log10(2) and lands either on the true result or one above it, which one table compare settles.
+			return x > 0 ? log10_adjust((bit_width(x) * 1233) >> 12, x) : 0;
 		}
 
 		/// @brief Exponentiates a number by another number.
 		/// @param x The base.
 		/// @param n The exponent.
 		/// @return The result.
-		inline uint64_t exp(uint64_t x, int32_t n)
+		constexpr uint64_t exp(uint64_t x, int32_t n)
+		{
+			return n > 0 ? x * exp(x, n - 1) : 1;
+		}
+
+		/// @brief Compile-time constants and helpers used to scale a base-10 fraction into the binary representation of a fixed-point number.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		template < uint32_t bits, uint32_t precision >
+		struct frac_scale
 		{
-			uint64_t X = 1;
-			for (; n > 0; --n) {
-				X *= x;
+			typedef typename intinfo<bits>::int_t  int_t;
+			typedef typename intinfo<bits>::uint_t uint_t;
+
+			static constexpr uint_t   MAX_FRAC        = (uint_t(1) << precision) - 1;                           // The largest fractional bit pattern.
+			static constexpr uint32_t MAX_FRAC_LOG10  = log10(MAX_FRAC) - 1;                                    // The number of whole base-10 digits that fit in the fractional bits.
+			static constexpr uint32_t MAX_FRAC_BASE10 = uint32_t(exp(10, int32_t(MAX_FRAC_LOG10)) - 1);         // The largest base-10 fraction that fits in the fractional bits.
+			static constexpr int_t    SCALE           = int_t(MAX_FRAC / (MAX_FRAC_BASE10 + 1));                // The base-10-to-binary scale factor.
+
+			/// @brief Scales a base-10 fraction so that its most significant digit lines up with the largest representable fraction.
+			/// @param d The fractional part of the number in base 10.
+			/// @param l10 The log10 of the fractional part.
+			/// @return The rescaled fraction.
+			static constexpr uint_t rescale(uint_t d, uint32_t l10)
+			{
+				return l10 >= MAX_FRAC_LOG10
+					? uint_t(div_pow10(d, l10 - MAX_FRAC_LOG10 + 1))
+					: uint_t(d * pow10(MAX_FRAC_LOG10 - l10 - 1));
+			}
+
+			/// @brief Converts a base-10 fraction into fractional bits.
+			/// @param d The fractional part of the number in base 10.
+			/// @return The fractional bits.
+			/// @note The fractional parameter is scaled properly, meaning 9 is the same as 90, 900, 9000, etc.
+			static constexpr int_t frac_bits(uint_t d)
+			{
+				return d > 0 ? int_t(uint64_t(rescale(d, log10(d))) * uint_t(SCALE)) : int_t(0);
 			}
-			return X;
+		};
+
+		/// @brief Converts the bit representation of one fixed-point format into another. The shift direction and the widening are selected at compile time from the template parameters, so the conversion compiles down to a single sign-preserving shift plus an optional truncation.
+		/// @tparam from_bits The total number of bits of the source format.
+		/// @tparam from_precision The number of bits dedicated to decimals in the source format.
+		/// @tparam to_bits The total number of bits of the destination format.
+		/// @tparam to_precision The number of bits dedicated to decimals in the destination format.
+		/// @param x The bit representation in the source format.
+		/// @return The bit representation in the destination format.
+		/// @note Fractional bits are truncated toward negative infinity when the destination precision is lower, and whole bits that do not fit the destination width are truncated.
+		template < uint32_t from_bits, uint32_t from_precision, uint32_t to_bits, uint32_t to_precision >
+		constexpr typename intinfo<to_bits>::int_t convert_bits(typename intinfo<from_bits>::int_t x)
+		{
+			typedef typename intinfo<(from_bits > to_bits ? from_bits : to_bits)>::int_t  wide_int_t;
+			typedef typename intinfo<(from_bits > to_bits ? from_bits : to_bits)>::uint_t wide_uint_t;
+			return typename intinfo<to_bits>::int_t(
+				wide_uint_t(wide_int_t(x >> (from_precision > to_precision ? from_precision - to_precision : 0))) << (to_precision > from_precision ? to_precision - from_precision : 0)
+			);
 		}
 	}
 
@@ -94,6 +318,12 @@ namespace cc0
 		typedef typename cc0::fixed_internal::intinfo<bits>::int_t int_t;
 		typedef typename cc0::fixed_internal::intinfo<bits>::uint_t uint_t;
 
+	private:
+		/// @brief Adopts a bit representation verbatim. For internal use by from_bits.
+		/// @param n The bit representation.
+		/// @param NA The tag selecting this constructor.
+		constexpr fixed(int_t n, cc0::fixed_internal::raw_bits) : value_bits(n) {}
+
 	public:
 		int_t value_bits; // The binary representation of the fixed-point number.
 
@@ -111,31 +341,44 @@ namespace cc0
 
 		/// @brief A conversion constructor that converts an integer into a fixed-point number by upscaling it.
 		/// @param n The number to upscale into a fixed-point number.
-		fixed(int_t n) : value_bits(n << precision) {}
+		constexpr fixed(int_t n) : value_bits(int_t(uint_t(n) << precision)) {}
 
 		/// @brief Converts two integers into a fixed-point number.
 		/// @param i The integer part of the number.
 		/// @param d The fractional part of the number in base 10.
 		/// @note The fractional parameter is scaled properly, meaning 9 is the same as 90, 900, 9000, etc.
-		fixed(int_t i, uint_t d);
+		constexpr fixed(int_t i, uint_t d);
+
+		/// @brief A conversion constructor that converts a fixed-point number of another bit width and/or precision into this format.
+		/// @tparam bits2 The total number of bits of the source format.
+		/// @tparam precision2 The number of bits dedicated to decimals in the source format.
+		/// @param f The number to convert.
+		/// @note Fractional bits are truncated toward negative infinity when this precision is lower than the source precision, and whole bits that do not fit this width are truncated.
+		template < uint32_t bits2, uint32_t precision2 >
+		explicit constexpr fixed(fixed<bits2,precision2> f);
+
+		/// @brief Creates a fixed-point number directly from a bit representation, without any scaling.
+		/// @param n The bit representation.
+		/// @return The fixed-point number.
+		static constexpr fixed from_bits(int_t n) { return fixed(n, cc0::fixed_internal::raw_bits{}); }
 
 		/// @brief A conversion operator converting the fixed-point number into an integer by downscaling it.
-		operator int_t( void ) const { return value_bits >> precision; }
+		constexpr operator int_t( void ) const { return value_bits >> precision; }
 
 		/// @brief Addition.
 		/// @param r The right-hand side operator.
 		/// @return The result.
-		fixed &operator+=(fixed r) { value_bits += r.value_bits; return *this; }
+		CC0_FIXED_CONSTEXPR fixed &operator+=(fixed r) { value_bits += r.value_bits; return *this; }
 
 		/// @brief Subtraction.
 		/// @param r The right-hand side operator.
 		/// @return The result.
-		fixed &operator-=(fixed r) { value_bits -= r.value_bits; return *this; }
+		CC0_FIXED_CONSTEXPR fixed &operator-=(fixed r) { value_bits -= r.value_bits; return *this; }
 		
 		/// @brief Multiplication.
 		/// @param r The right-hand side operator.
 		/// @return The result.
-		fixed &operator*=(fixed r) {
+		CC0_FIXED_CONSTEXPR fixed &operator*=(fixed r) {
 			typename fixed_internal::intinfo<bits>::next::int_t n = typename fixed_internal::intinfo<bits>::next::int_t(value_bits) * r.value_bits;
 			value_bits = (n >> precision);
 			return *this;
@@ -144,75 +387,375 @@ namespace cc0
 		/// @brief Division.
 		/// @param r The right-hand side operator.
 		/// @return The result.
-		fixed &operator/=(fixed r) {
+		CC0_FIXED_CONSTEXPR fixed &operator/=(fixed r) {
 			value_bits = (typename fixed_internal::intinfo<bits>::next::int_t(value_bits) << precision) / r.value_bits;
 			return *this;
 		}
 
+		/// @brief Fused multiply-add. Adds the product of two fixed-point numbers to this number, keeping the product and the accumulator in the widened intermediate so only one downscaling shift is paid instead of one per operation.
+		/// @param a The left-hand side operand of the product.
+		/// @param b The right-hand side operand of the product.
+		/// @return The result.
+		/// @note For 64-bit base types the widened intermediate aliases the base type, so the product may silently truncate just like operator*=.
+		CC0_FIXED_CONSTEXPR fixed &mul_add(fixed a, fixed b) {
+			value_bits = int_t((typename fixed_internal::intinfo<bits>::next::int_t(a.value_bits) * b.value_bits + (typename fixed_internal::intinfo<bits>::next::int_t(value_bits) << precision)) >> precision);
+			return *this;
+		}
+
 		/// @brief Addition.
 		/// @param r The right-hand side operator.
 		/// @return The result.
-		fixed &operator+=(int_t r) { value_bits += (r << precision); return *this; }
+		CC0_FIXED_CONSTEXPR fixed &operator+=(int_t r) { value_bits += int_t(uint_t(r) << precision); return *this; }
 
 		/// @brief Subtraction.
 		/// @param r The right-hand side operator.
 		/// @return The result.
-		fixed &operator-=(int_t r) { value_bits -= (r << precision); return *this; }
+		CC0_FIXED_CONSTEXPR fixed &operator-=(int_t r) { value_bits -= int_t(uint_t(r) << precision); return *this; }
 		
 		/// @brief Multiplication.
 		/// @param r The right-hand side operator.
 		/// @return The result.
-		fixed &operator*=(int_t r) { value_bits *= r; return *this; }
+		CC0_FIXED_CONSTEXPR fixed &operator*=(int_t r) { value_bits *= r; return *this; }
 
 		/// @brief Division.
 		/// @param r The right-hand side operator.
 		/// @return The result.
-		fixed &operator/=(int_t r) { value_bits /= r; return *this; }
+		CC0_FIXED_CONSTEXPR fixed &operator/=(int_t r) { value_bits /= r; return *this; }
 
 		/// @brief Pre-increment.
 		/// @return A reference to the state of the variable after increment.
-		fixed &operator++( void ) { return *this += 1; }
+		CC0_FIXED_CONSTEXPR fixed &operator++( void ) { return *this += 1; }
 
 		/// @brief Post-increment.
 		/// @return The state of the variable before increment.
-		fixed operator++( int ) { auto t = *this; *this += 1; return t; }
+		CC0_FIXED_CONSTEXPR fixed operator++( int ) { auto t = *this; *this += 1; return t; }
 
 		/// @brief Pre-decrement.
 		/// @return A reference to the state of the variable after decrement.
-		fixed &operator--( void ) { return *this -= 1; }
+		CC0_FIXED_CONSTEXPR fixed &operator--( void ) { return *this -= 1; }
 
 		/// @brief Post-decrement.
 		/// @return The state of the variable before decrement.
-		fixed operator--( int ) { auto t = *this; *this -= 1; return t; }
+		CC0_FIXED_CONSTEXPR fixed operator--( int ) { auto t = *this; *this -= 1; return t; }
 	};
-}
 
-template < uint32_t bits, uint32_t precision >
-cc0::fixed<bits,precision>::fixed(cc0::fixed<bits,precision>::int_t i, cc0::fixed<bits,precision>::uint_t d) : value_bits(i << precision)
-{
-	static constexpr typename cc0::fixed_internal::intinfo<bits>::uint_t MAX_FRAC        = (typename cc0::fixed_internal::intinfo<bits>::uint_t(1) << precision) - 1;
-	static const uint32_t                                                MAX_FRAC_LOG10  = cc0::fixed_internal::log10(MAX_FRAC) - 1;
-	static const uint32_t                                                MAX_FRAC_BASE10 = cc0::fixed_internal::exp(10, MAX_FRAC_LOG10) - 1;
-	static const cc0::fixed<bits,bits-precision-1>                       SCALE           = cc0::fixed<bits,bits-precision-1>(MAX_FRAC) / (MAX_FRAC_BASE10 + 1);
-	
-	if (d > 0) {
-		const uint32_t log10 = cc0::fixed_internal::log10(d);
-		if (log10 >= MAX_FRAC_LOG10) {
-			d /= cc0::fixed_internal::exp(10, log10 - MAX_FRAC_LOG10 + 1);
-		} else {
-			d *= cc0::fixed_internal::exp(10, MAX_FRAC_LOG10 - log10 - 1);
+	/// @brief Tag types selecting how the intermediate product of a multiplication is represented.
+	namespace mul_policy
+	{
+		/// @brief The default policy. Widens via the next larger intinfo type, which for 64-bit base types aliases itself and may silently truncate.
+		struct narrow {};
+
+		/// @brief Widens through a genuine double-width intermediate. Uses the compiler's 128-bit type where available, otherwise falls back to a high/low-word decomposition.
+		struct wide {};
+
+		/// @brief Widens through an explicit high/low-word decomposition of the product, regardless of compiler support for 128-bit types.
+		struct fast_split {};
+	}
+
+	/// @brief Tag types selecting how the downscaling shift rounds the discarded fractional bits. Truncation is what the operators do and costs nothing extra; the other modes add a bias inside the widened intermediate before the shift, so they stay branchless.
+	namespace round_policy
+	{
+		/// @brief The default policy. Shifts the discarded bits out, truncating toward negative infinity. Identical to what the operators do.
+		struct truncate {};
+
+		/// @brief Rounds to the nearest representable value, with ties rounding toward positive infinity.
+		struct half_up {};
+
+		/// @brief Rounds to the nearest representable value, with ties rounding to the value whose last kept bit is zero. Statistically unbiased for tie-heavy signals.
+		struct half_even {};
+	}
+
+	/// @brief For internal use only.
+	namespace fixed_internal
+	{
+		/// @brief Multiplies two fixed-point bit representations through a genuine double-width intermediate.
+		/// @tparam bits The number of bits of the base data type.
+		template < uint32_t bits >
+		struct wide_mul
+		{
+			typedef typename intinfo<bits>::int_t int_t;
+
+			/// @brief Multiplies two bit representations and downscales the result.
+			/// @param l The left-hand side bit representation.
+			/// @param r The right-hand side bit representation.
+			/// @param precision The number of bits dedicated to decimals.
+			/// @return The downscaled product.
+			static int_t mul(int_t l, int_t r, uint32_t precision) {
+				return int_t((typename intinfo<bits>::next::int_t(l) * r) >> precision);
+			}
+		};
+
+		/// @brief Multiplies two 64-bit fixed-point bit representations through a 128-bit intermediate built from two 64-bit words.
+		template <>
+		struct wide_mul<64>
+		{
+			/// @brief Multiplies two bit representations and downscales the result.
+			/// @param l The left-hand side bit representation.
+			/// @param r The right-hand side bit representation.
+			/// @param precision The number of bits dedicated to decimals.
+			/// @return The downscaled product.
+			static int64_t mul(int64_t l, int64_t r, uint32_t precision) {
+				int64_t  hi;
+				uint64_t lo;
+				imul128(l, r, hi, lo);
+				return precision > 0 ? int64_t((lo >> precision) | (uint64_t(hi) << (64 - precision))) : int64_t(lo);
+			}
+		};
+	}
+
+	/// @brief Multiplies two fixed-point numbers using the default narrowing intermediate. Identical to operator*.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @param l The left-hand side operand.
+	/// @param r The right-hand side operand.
+	/// @param NA The policy selector.
+	/// @return The result.
+	template < uint32_t bits, uint32_t precision >
+	inline fixed<bits,precision> mul(fixed<bits,precision> l, fixed<bits,precision> r, mul_policy::narrow)
+	{
+		return l *= r;
+	}
+
+	/// @brief Multiplies two fixed-point numbers through an explicit high/low-word decomposition of the full product.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @param l The left-hand side operand.
+	/// @param r The right-hand side operand.
+	/// @param NA The policy selector.
+	/// @return The result.
+	template < uint32_t bits, uint32_t precision >
+	inline fixed<bits,precision> mul(fixed<bits,precision> l, fixed<bits,precision> r, mul_policy::fast_split)
+	{
+		int64_t  hi;
+		uint64_t lo;
+		fixed_internal::imul128(int64_t(l.value_bits), int64_t(r.value_bits), hi, lo);
+		fixed<bits,precision> out;
+		out.value_bits = typename fixed_internal::intinfo<bits>::int_t(precision > 0 ? int64_t((lo >> precision) | (uint64_t(hi) << (64 - precision))) : int64_t(lo));
+		return out;
+	}
+
+	/// @brief Multiplies two fixed-point numbers through a genuine double-width intermediate, so that a 64-bit base type does not silently truncate its product.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @param l The left-hand side operand.
+	/// @param r The right-hand side operand.
+	/// @param NA The policy selector.
+	/// @return The result.
+	/// @note For base types below 64 bits this is identical to operator*, which already widens losslessly.
+	template < uint32_t bits, uint32_t precision >
+	inline fixed<bits,precision> mul(fixed<bits,precision> l, fixed<bits,precision> r, mul_policy::wide)
+	{
+#if defined(__SIZEOF_INT128__)
+		if (bits == 64) {
+			fixed<bits,precision> out;
+			out.value_bits = typename fixed_internal::intinfo<bits>::int_t((__int128(l.value_bits) * r.value_bits) >> precision);
+			return out;
 		}
-		value_bits += typename cc0::fixed_internal::intinfo<bits>::int_t(d * SCALE);
+#endif
+		fixed<bits,precision> out;
+		out.value_bits = fixed_internal::wide_mul<bits>::mul(l.value_bits, r.value_bits, precision);
+		return out;
+	}
+
+	/// @brief Multiplies two fixed-point numbers, truncating toward negative infinity. Identical to operator*.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @param l The left-hand side operand.
+	/// @param r The right-hand side operand.
+	/// @param NA The policy selector.
+	/// @return The result.
+	template < uint32_t bits, uint32_t precision >
+	inline fixed<bits,precision> mul(fixed<bits,precision> l, fixed<bits,precision> r, round_policy::truncate)
+	{
+		return l *= r;
+	}
+
+	/// @brief Multiplies two fixed-point numbers, rounding the product to the nearest representable value with ties toward positive infinity. The bias is added inside the widened intermediate before the downscaling shift, so no branch is paid.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @param l The left-hand side operand.
+	/// @param r The right-hand side operand.
+	/// @param NA The policy selector.
+	/// @return The result.
+	template < uint32_t bits, uint32_t precision >
+	inline fixed<bits,precision> mul(fixed<bits,precision> l, fixed<bits,precision> r, round_policy::half_up)
+	{
+		typedef typename fixed_internal::intinfo<bits>::next::int_t  wide_t;
+		typedef typename fixed_internal::intinfo<bits>::next::uint_t uwide_t;
+		const wide_t n = wide_t(l.value_bits) * r.value_bits;
+		fixed<bits,precision> out;
+		out.value_bits = typename fixed_internal::intinfo<bits>::int_t(precision > 0 ? (n + wide_t(uwide_t(1) << (precision > 0 ? precision - 1 : 0))) >> precision : n);
+		return out;
+	}
+
+	/// @brief Multiplies two fixed-point numbers, rounding the product to the nearest representable value with ties to even. The tie adjustment folds into the additive bias inside the widened intermediate, so no branch is paid.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @param l The left-hand side operand.
+	/// @param r The right-hand side operand.
+	/// @param NA The policy selector.
+	/// @return The result.
+	template < uint32_t bits, uint32_t precision >
+	inline fixed<bits,precision> mul(fixed<bits,precision> l, fixed<bits,precision> r, round_policy::half_even)
+	{
+		typedef typename fixed_internal::intinfo<bits>::next::int_t  wide_t;
+		typedef typename fixed_internal::intinfo<bits>::next::uint_t uwide_t;
+		const wide_t n = wide_t(l.value_bits) * r.value_bits;
+		fixed<bits,precision> out;
+		out.value_bits = typename fixed_internal::intinfo<bits>::int_t(precision > 0 ? (n + wide_t(uwide_t(1) << (precision > 0 ? precision - 1 : 0)) - 1 + ((n >> precision) & 1)) >> precision : n);
+		return out;
+	}
+
+	/// @brief Converts a fixed-point number into an integer, truncating toward negative infinity. Identical to the int conversion operator.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @param f The number to convert.
+	/// @param NA The policy selector.
+	/// @return The integer.
+	template < uint32_t bits, uint32_t precision >
+	constexpr typename fixed_internal::intinfo<bits>::int_t to_int(fixed<bits,precision> f, round_policy::truncate)
+	{
+		return f.value_bits >> precision;
+	}
+
+	/// @brief Converts a fixed-point number into an integer, rounding to the nearest whole number with ties toward positive infinity. The bias is added in the widened type so the addition cannot overflow, and no branch is paid.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @param f The number to convert.
+	/// @param NA The policy selector.
+	/// @return The integer.
+	template < uint32_t bits, uint32_t precision >
+	constexpr typename fixed_internal::intinfo<bits>::int_t to_int(fixed<bits,precision> f, round_policy::half_up)
+	{
+		return typename fixed_internal::intinfo<bits>::int_t(precision > 0
+			? (typename fixed_internal::intinfo<bits>::next::int_t(f.value_bits) + typename fixed_internal::intinfo<bits>::next::int_t(typename fixed_internal::intinfo<bits>::next::uint_t(1) << (precision > 0 ? precision - 1 : 0))) >> precision
+			: typename fixed_internal::intinfo<bits>::next::int_t(f.value_bits));
 	}
+
+	/// @brief Converts a fixed-point number into an integer, rounding to the nearest whole number with ties to even. The tie adjustment folds into the additive bias in the widened type, so no branch is paid.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @param f The number to convert.
+	/// @param NA The policy selector.
+	/// @return The integer.
+	template < uint32_t bits, uint32_t precision >
+	constexpr typename fixed_internal::intinfo<bits>::int_t to_int(fixed<bits,precision> f, round_policy::half_even)
+	{
+		return typename fixed_internal::intinfo<bits>::int_t(precision > 0
+			? (typename fixed_internal::intinfo<bits>::next::int_t(f.value_bits) + typename fixed_internal::intinfo<bits>::next::int_t(typename fixed_internal::intinfo<bits>::next::uint_t(1) << (precision > 0 ? precision - 1 : 0)) - 1 + ((f.value_bits >> precision) & 1)) >> precision
+			: typename fixed_internal::intinfo<bits>::next::int_t(f.value_bits));
+	}
+
+	/// @brief Converts a fixed-point number into another bit width and/or precision. The destination format is given first so the source format can be deduced from the argument.
+	/// @tparam to_bits The total number of bits of the destination format. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam to_precision The number of bits dedicated to decimals in the destination format.
+	/// @tparam from_bits The total number of bits of the source format.
+	/// @tparam from_precision The number of bits dedicated to decimals in the source format.
+	/// @param f The number to convert.
+	/// @return The converted number.
+	/// @note Fractional bits are truncated toward negative infinity when the destination precision is lower, and whole bits that do not fit the destination width are truncated.
+	template < uint32_t to_bits, uint32_t to_precision, uint32_t from_bits, uint32_t from_precision >
+	constexpr fixed<to_bits,to_precision> fixed_cast(fixed<from_bits,from_precision> f)
+	{
+		return fixed<to_bits,to_precision>(f);
+	}
+
+	/// @brief Converts an array of fixed-point numbers into another bit width and/or precision.
+	/// @tparam to_bits The total number of bits of the destination format. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam to_precision The number of bits dedicated to decimals in the destination format.
+	/// @tparam from_bits The total number of bits of the source format.
+	/// @tparam from_precision The number of bits dedicated to decimals in the source format.
+	/// @param dst The destination array.
+	/// @param src The source array. May alias dst only when the destination format is not wider than the source format.
+	/// @param n The number of elements to convert.
+	template < uint32_t to_bits, uint32_t to_precision, uint32_t from_bits, uint32_t from_precision >
+	void fixed_cast(fixed<to_bits,to_precision> *dst, const fixed<from_bits,from_precision> *src, uint64_t n)
+	{
+		for (uint64_t i = 0; i < n; ++i) {
+			dst[i] = fixed<to_bits,to_precision>(src[i]);
+		}
+	}
+
+	/// @brief Fused multiply-add. Returns acc + a * b with the product and the accumulator kept in the widened intermediate, so only one downscaling shift is paid instead of one per operation.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @param acc The accumulator.
+	/// @param a The left-hand side operand of the product.
+	/// @param b The right-hand side operand of the product.
+	/// @return The result.
+	/// @note For 64-bit base types the widened intermediate aliases the base type, so the product may silently truncate just like operator*.
+	template < uint32_t bits, uint32_t precision >
+	inline CC0_FIXED_CONSTEXPR fixed<bits,precision> fmadd(fixed<bits,precision> acc, fixed<bits,precision> a, fixed<bits,precision> b)
+	{
+		return acc.mul_add(a, b);
+	}
+
+	/// @brief An accumulator that stays in the widened intermediate across many fused multiply-adds and narrows back to a fixed-point number once at the end. Chaining N products through it costs one downscaling shift total instead of N, and the low product bits are not discarded between taps.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @note For 64-bit base types the widened intermediate aliases the base type, so the accumulated products may silently truncate just like operator*.
+	template < uint32_t bits, uint32_t precision >
+	class fixed_accumulator
+	{
+	private:
+		typedef typename cc0::fixed_internal::intinfo<bits>::int_t        int_t;
+		typedef typename cc0::fixed_internal::intinfo<bits>::next::int_t  wide_t;
+		typedef typename cc0::fixed_internal::intinfo<bits>::next::uint_t uwide_t;
+
+	private:
+		wide_t m_sum; // The running sum in the widened product domain, i.e. with twice the fractional bits.
+
+	public:
+		/// @brief Constructs an accumulator holding zero.
+		CC0_FIXED_CONSTEXPR fixed_accumulator( void ) : m_sum(0) {}
+
+		/// @brief Constructs an accumulator holding a fixed-point number.
+		/// @param f The number to start accumulating from.
+		constexpr explicit fixed_accumulator(fixed<bits,precision> f) : m_sum(wide_t(uwide_t(wide_t(f.value_bits)) << precision)) {}
+
+		/// @brief Adds the product of two fixed-point numbers to the running sum without narrowing it.
+		/// @param a The left-hand side operand of the product.
+		/// @param b The right-hand side operand of the product.
+		/// @return A reference to the accumulator.
+		CC0_FIXED_CONSTEXPR fixed_accumulator &mul_add(fixed<bits,precision> a, fixed<bits,precision> b) { m_sum += wide_t(a.value_bits) * b.value_bits; return *this; }
+
+		/// @brief Adds a fixed-point number to the running sum.
+		/// @param r The right-hand side operator.
+		/// @return A reference to the accumulator.
+		CC0_FIXED_CONSTEXPR fixed_accumulator &operator+=(fixed<bits,precision> r) { m_sum += wide_t(uwide_t(wide_t(r.value_bits)) << precision); return *this; }
+
+		/// @brief Subtracts a fixed-point number from the running sum.
+		/// @param r The right-hand side operator.
+		/// @return A reference to the accumulator.
+		CC0_FIXED_CONSTEXPR fixed_accumulator &operator-=(fixed<bits,precision> r) { m_sum -= wide_t(uwide_t(wide_t(r.value_bits)) << precision); return *this; }
+
+		/// @brief Narrows the running sum back to a fixed-point number with a single downscaling shift.
+		/// @return The accumulated value.
+		fixed<bits,precision> narrow( void ) const
+		{
+			fixed<bits,precision> out;
+			out.value_bits = int_t(m_sum >> precision);
+			return out;
+		}
+	};
 }
 
+template < uint32_t bits, uint32_t precision >
+constexpr cc0::fixed<bits,precision>::fixed(cc0::fixed<bits,precision>::int_t i, cc0::fixed<bits,precision>::uint_t d) : value_bits(int_t(uint_t(i) << precision) + cc0::fixed_internal::frac_scale<bits,precision>::frac_bits(d))
+{}
+
+template < uint32_t bits, uint32_t precision >
+template < uint32_t bits2, uint32_t precision2 >
+constexpr cc0::fixed<bits,precision>::fixed(cc0::fixed<bits2,precision2> f) : value_bits(cc0::fixed_internal::convert_bits<bits2,precision2,bits,precision>(f.value_bits))
+{}
+
 /// @brief Addition.
 /// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
 /// @tparam precision The number of bits dedicated to decimals.
 /// @param l The left-hand side operand.
 /// @param r The right-hand side operand.
 /// @return The result.
-template < uint32_t bits, uint32_t precision > inline cc0::fixed<bits,precision> operator+(cc0::fixed<bits,precision> l, cc0::fixed<bits,precision> r) { return l += r; }
+template < uint32_t bits, uint32_t precision > inline CC0_FIXED_CONSTEXPR cc0::fixed<bits,precision> operator+(cc0::fixed<bits,precision> l, cc0::fixed<bits,precision> r) { return l += r; }
 
 /// @brief Subtraction.
 /// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
@@ -220,7 +763,7 @@ template < uint32_t bits, uint32_t precision > inline cc0::fixed<bits,precision>
 /// @param l The left-hand side operand.
 /// @param r The right-hand side operand.
 /// @return The result.
-template < uint32_t bits, uint32_t precision > inline cc0::fixed<bits,precision> operator-(cc0::fixed<bits,precision> l, cc0::fixed<bits,precision> r) { return l -= r; }
+template < uint32_t bits, uint32_t precision > inline CC0_FIXED_CONSTEXPR cc0::fixed<bits,precision> operator-(cc0::fixed<bits,precision> l, cc0::fixed<bits,precision> r) { return l -= r; }
 
 /// @brief Multiplication.
 /// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
@@ -228,7 +771,7 @@ template < uint32_t bits, uint32_t precision > inline cc0::fixed<bits,precision>
 /// @param l The left-hand side operand.
 /// @param r The right-hand side operand.
 /// @return The result.
-template < uint32_t bits, uint32_t precision > inline cc0::fixed<bits,precision> operator*(cc0::fixed<bits,precision> l, cc0::fixed<bits,precision> r) { return l *= r; }
+template < uint32_t bits, uint32_t precision > inline CC0_FIXED_CONSTEXPR cc0::fixed<bits,precision> operator*(cc0::fixed<bits,precision> l, cc0::fixed<bits,precision> r) { return l *= r; }
 
 /// @brief Division.
 /// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
@@ -236,7 +779,7 @@ template < uint32_t bits, uint32_t precision > inline cc0::fixed<bits,precision>
 /// @param l The left-hand side operand.
 /// @param r The right-hand side operand.
 /// @return The result.
-template < uint32_t bits, uint32_t precision > inline cc0::fixed<bits,precision> operator/(cc0::fixed<bits,precision> l, cc0::fixed<bits,precision> r) { return l /= r; }
+template < uint32_t bits, uint32_t precision > inline CC0_FIXED_CONSTEXPR cc0::fixed<bits,precision> operator/(cc0::fixed<bits,precision> l, cc0::fixed<bits,precision> r) { return l /= r; }
 
 /// @brief Addition.
 /// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
@@ -244,7 +787,7 @@ template < uint32_t bits, uint32_t precision > inline cc0::fixed<bits,precision>
 /// @param l The left-hand side operand.
 /// @param r The right-hand side operand.
 /// @return The result.
-template < uint32_t bits, uint32_t precision > inline cc0::fixed<bits,precision> operator+(cc0::fixed<bits,precision> l, typename cc0::fixed<bits,precision>::fixed_internal::intinfo<bits>::int_t r) { return l += r; }
+template < uint32_t bits, uint32_t precision > inline CC0_FIXED_CONSTEXPR cc0::fixed<bits,precision> operator+(cc0::fixed<bits,precision> l, typename cc0::fixed<bits,precision>::fixed_internal::intinfo<bits>::int_t r) { return l += r; }
 
 /// @brief Subtraction.
 /// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
@@ -252,7 +795,7 @@ template < uint32_t bits, uint32_t precision > inline cc0::fixed<bits,precision>
 /// @param l The left-hand side operand.
 /// @param r The right-hand side operand.
 /// @return The result.
-template < uint32_t bits, uint32_t precision > inline cc0::fixed<bits,precision> operator-(cc0::fixed<bits,precision> l, typename cc0::fixed<bits,precision>::fixed_internal::intinfo<bits>::int_t r) { return l -= r; }
+template < uint32_t bits, uint32_t precision > inline CC0_FIXED_CONSTEXPR cc0::fixed<bits,precision> operator-(cc0::fixed<bits,precision> l, typename cc0::fixed<bits,precision>::fixed_internal::intinfo<bits>::int_t r) { return l -= r; }
 
 /// @brief Multiplication.
 /// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
@@ -260,7 +803,7 @@ template < uint32_t bits, uint32_t precision > inline cc0::fixed<bits,precision>
 /// @param l The left-hand side operand.
 /// @param r The right-hand side operand.
 /// @return The result.
-template < uint32_t bits, uint32_t precision > inline cc0::fixed<bits,precision> operator*(cc0::fixed<bits,precision> l, typename cc0::fixed<bits,precision>::fixed_internal::intinfo<bits>::int_t r) { return l *= r; }
+template < uint32_t bits, uint32_t precision > inline CC0_FIXED_CONSTEXPR cc0::fixed<bits,precision> operator*(cc0::fixed<bits,precision> l, typename cc0::fixed<bits,precision>::fixed_internal::intinfo<bits>::int_t r) { return l *= r; }
 
 /// @brief Division.
 /// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
@@ -268,7 +811,7 @@ template < uint32_t bits, uint32_t precision > inline cc0::fixed<bits,precision>
 /// @param l The left-hand side operand.
 /// @param r The right-hand side operand.
 /// @return The result.
-template < uint32_t bits, uint32_t precision > inline cc0::fixed<bits,precision> operator/(cc0::fixed<bits,precision> l, typename cc0::fixed<bits,precision>::fixed_internal::intinfo<bits>::int_t r) { return l /= r; }
+template < uint32_t bits, uint32_t precision > inline CC0_FIXED_CONSTEXPR cc0::fixed<bits,precision> operator/(cc0::fixed<bits,precision> l, typename cc0::fixed<bits,precision>::fixed_internal::intinfo<bits>::int_t r) { return l /= r; }
 
 /// @brief Addition.
 /// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
@@ -276,7 +819,7 @@ template < uint32_t bits, uint32_t precision > inline cc0::fixed<bits,precision>
 /// @param l The left-hand side operand.
 /// @param r The right-hand side operand.
 /// @return The result.
-template < uint32_t bits, uint32_t precision > inline cc0::fixed<bits,precision> operator+(typename cc0::fixed<bits,precision>::fixed_internal::intinfo<bits>::int_t l, cc0::fixed<bits,precision> r) { return r += l; }
+template < uint32_t bits, uint32_t precision > inline CC0_FIXED_CONSTEXPR cc0::fixed<bits,precision> operator+(typename cc0::fixed<bits,precision>::fixed_internal::intinfo<bits>::int_t l, cc0::fixed<bits,precision> r) { return r += l; }
 
 /// @brief Subtraction.
 /// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
@@ -284,7 +827,7 @@ template < uint32_t bits, uint32_t precision > inline cc0::fixed<bits,precision>
 /// @param l The left-hand side operand.
 /// @param r The right-hand side operand.
 /// @return The result.
-template < uint32_t bits, uint32_t precision > inline cc0::fixed<bits,precision> operator-(typename cc0::fixed<bits,precision>::fixed_internal::intinfo<bits>::int_t l, cc0::fixed<bits,precision> r) { return cc0::fixed<bits,precision>(l) -= r; }
+template < uint32_t bits, uint32_t precision > inline CC0_FIXED_CONSTEXPR cc0::fixed<bits,precision> operator-(typename cc0::fixed<bits,precision>::fixed_internal::intinfo<bits>::int_t l, cc0::fixed<bits,precision> r) { return cc0::fixed<bits,precision>(l) -= r; }
 
 /// @brief Multiplication.
 /// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
@@ -292,7 +835,7 @@ template < uint32_t bits, uint32_t precision > inline cc0::fixed<bits,precision>
 /// @param l The left-hand side operand.
 /// @param r The right-hand side operand.
 /// @return The result.
-template < uint32_t bits, uint32_t precision > inline cc0::fixed<bits,precision> operator*(typename cc0::fixed<bits,precision>::fixed_internal::intinfo<bits>::int_t l, cc0::fixed<bits,precision> r) { return r *= l; }
+template < uint32_t bits, uint32_t precision > inline CC0_FIXED_CONSTEXPR cc0::fixed<bits,precision> operator*(typename cc0::fixed<bits,precision>::fixed_internal::intinfo<bits>::int_t l, cc0::fixed<bits,precision> r) { return r *= l; }
 
 /// @brief Division.
 /// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
@@ -300,7 +843,7 @@ template < uint32_t bits, uint32_t precision > inline cc0::fixed<bits,precision>
 /// @param l The left-hand side operand.
 /// @param r The right-hand side operand.
 /// @return The result.
-template < uint32_t bits, uint32_t precision > inline cc0::fixed<bits,precision> operator/(typename cc0::fixed<bits,precision>::fixed_internal::intinfo<bits>::int_t l, cc0::fixed<bits,precision> r) { return cc0::fixed<bits,precision>(l) /= r; }
+template < uint32_t bits, uint32_t precision > inline CC0_FIXED_CONSTEXPR cc0::fixed<bits,precision> operator/(typename cc0::fixed<bits,precision>::fixed_internal::intinfo<bits>::int_t l, cc0::fixed<bits,precision> r) { return cc0::fixed<bits,precision>(l) /= r; }
 
 /// @brief Equality.
 /// @tparam bits The total number of bits for the base data type. Supported sizes are8, 16, 32, and 64.
@@ -308,7 +851,7 @@ template < uint32_t bits, uint32_t precision > inline cc0::fixed<bits,precision>
 /// @param l The left-hand side operand.
 /// @param r The right-hand side operand.
 /// @return The result.
-template < uint32_t bits, uint32_t precision > inline bool operator==(cc0::fixed<bits,precision> l, cc0::fixed<bits,precision> r) { return l.value_bits == r.value_bits; }
+template < uint32_t bits, uint32_t precision > inline constexpr bool operator==(cc0::fixed<bits,precision> l, cc0::fixed<bits,precision> r) { return l.value_bits == r.value_bits; }
 
 /// @brief Inequality.
 /// @tparam bits The total number of bits for the base data type. Supported sizes are8, 16, 32, and 64.
@@ -316,7 +859,7 @@ template < uint32_t bits, uint32_t precision > inline bool operator==(cc0::fixed
 /// @param l The left-hand side operand.
 /// @param r The right-hand side operand.
 /// @return The result.
-template < uint32_t bits, uint32_t precision > inline bool operator!=(cc0::fixed<bits,precision> l, cc0::fixed<bits,precision> r) { return l.value_bits != r.value_bits; }
+template < uint32_t bits, uint32_t precision > inline constexpr bool operator!=(cc0::fixed<bits,precision> l, cc0::fixed<bits,precision> r) { return l.value_bits != r.value_bits; }
 
 /// @brief Less than.
 /// @tparam bits The total number of bits for the base data type. Supported sizes are8, 16, 32, and 64.
@@ -324,7 +867,7 @@ template < uint32_t bits, uint32_t precision > inline bool operator!=(cc0::fixed
 /// @param l The left-hand side operand.
 /// @param r The right-hand side operand.
 /// @return The result.
-template < uint32_t bits, uint32_t precision > inline bool operator<(cc0::fixed<bits,precision> l, cc0::fixed<bits,precision> r) { return l.value_bits < r.value_bits; }
+template < uint32_t bits, uint32_t precision > inline constexpr bool operator<(cc0::fixed<bits,precision> l, cc0::fixed<bits,precision> r) { return l.value_bits < r.value_bits; }
 
 /// @brief Greater than.
 /// @tparam bits The total number of bits for the base data type. Supported sizes are8, 16, 32, and 64.
@@ -332,7 +875,7 @@ template < uint32_t bits, uint32_t precision > inline bool operator<(cc0::fixed<
 /// @param l The left-hand side operand.
 /// @param r The right-hand side operand.
 /// @return The result.
-template < uint32_t bits, uint32_t precision > inline bool operator>(cc0::fixed<bits,precision> l, cc0::fixed<bits,precision> r) { return l.value_bits > r.value_bits; }
+template < uint32_t bits, uint32_t precision > inline constexpr bool operator>(cc0::fixed<bits,precision> l, cc0::fixed<bits,precision> r) { return l.value_bits > r.value_bits; }
 
 /// @brief Less or equal.
 /// @tparam bits The total number of bits for the base data type. Supported sizes are8, 16, 32, and 64.
@@ -340,7 +883,7 @@ template < uint32_t bits, uint32_t precision > inline bool operator>(cc0::fixed<
 /// @param l The left-hand side operand.
 /// @param r The right-hand side operand.
 /// @return The result.
-template < uint32_t bits, uint32_t precision > inline bool operator<=(cc0::fixed<bits,precision> l, cc0::fixed<bits,precision> r) { return l.value_bits <= r.value_bits; }
+template < uint32_t bits, uint32_t precision > inline constexpr bool operator<=(cc0::fixed<bits,precision> l, cc0::fixed<bits,precision> r) { return l.value_bits <= r.value_bits; }
 
 /// @brief Greater or equal.
 /// @tparam bits The total number of bits for the base data type. Supported sizes are8, 16, 32, and 64.
@@ -348,7 +891,7 @@ template < uint32_t bits, uint32_t precision > inline bool operator<=(cc0::fixed
 /// @param l The left-hand side operand.
 /// @param r The right-hand side operand.
 /// @return The result.
-template < uint32_t bits, uint32_t precision > inline bool operator>=(cc0::fixed<bits,precision> l, cc0::fixed<bits,precision> r) { return l.value_bits >= r.value_bits; }
+template < uint32_t bits, uint32_t precision > inline constexpr bool operator>=(cc0::fixed<bits,precision> l, cc0::fixed<bits,precision> r) { return l.value_bits >= r.value_bits; }
 
 /// @brief Equality.
 /// @tparam bits The total number of bits for the base data type. Supported sizes are8, 16, 32, and 64.
@@ -356,7 +899,7 @@ template < uint32_t bits, uint32_t precision > inline bool operator>=(cc0::fixed
 /// @param l The left-hand side operand.
 /// @param r The right-hand side operand.
 /// @return The result.
-template < uint32_t bits, uint32_t precision > inline bool operator==(typename cc0::fixed_internal::intinfo<bits>::int_t l, cc0::fixed<bits,precision> r) { return (typename cc0::fixed_internal::intinfo<bits>::next::int_t(l) << precision) == r.value_bits; }
+template < uint32_t bits, uint32_t precision > inline constexpr bool operator==(typename cc0::fixed_internal::intinfo<bits>::int_t l, cc0::fixed<bits,precision> r) { return typename cc0::fixed_internal::intinfo<bits>::next::int_t(typename cc0::fixed_internal::intinfo<bits>::next::uint_t(typename cc0::fixed_internal::intinfo<bits>::next::int_t(l)) << precision) == r.value_bits; }
 
 /// @brief Inequality.
 /// @tparam bits The total number of bits for the base data type. Supported sizes are8, 16, 32, and 64.
@@ -364,7 +907,7 @@ template < uint32_t bits, uint32_t precision > inline bool operator==(typename c
 /// @param l The left-hand side operand.
 /// @param r The right-hand side operand.
 /// @return The result.
-template < uint32_t bits, uint32_t precision > inline bool operator!=(typename cc0::fixed_internal::intinfo<bits>::int_t l, cc0::fixed<bits,precision> r) { return (typename cc0::fixed_internal::intinfo<bits>::next::int_t(l) << precision) != r.value_bits; }
+template < uint32_t bits, uint32_t precision > inline constexpr bool operator!=(typename cc0::fixed_internal::intinfo<bits>::int_t l, cc0::fixed<bits,precision> r) { return typename cc0::fixed_internal::intinfo<bits>::next::int_t(typename cc0::fixed_internal::intinfo<bits>::next::uint_t(typename cc0::fixed_internal::intinfo<bits>::next::int_t(l)) << precision) != r.value_bits; }
 
 /// @brief Less than.
 /// @tparam bits The total number of bits for the base data type. Supported sizes are8, 16, 32, and 64.
@@ -372,7 +915,7 @@ template < uint32_t bits, uint32_t precision > inline bool operator!=(typename c
 /// @param l The left-hand side operand.
 /// @param r The right-hand side operand.
 /// @return The result.
-template < uint32_t bits, uint32_t precision > inline bool operator<(typename cc0::fixed_internal::intinfo<bits>::int_t l, cc0::fixed<bits,precision> r) { return (typename cc0::fixed_internal::intinfo<bits>::next::int_t(l) << precision) < r.value_bits; }
+template < uint32_t bits, uint32_t precision > inline constexpr bool operator<(typename cc0::fixed_internal::intinfo<bits>::int_t l, cc0::fixed<bits,precision> r) { return typename cc0::fixed_internal::intinfo<bits>::next::int_t(typename cc0::fixed_internal::intinfo<bits>::next::uint_t(typename cc0::fixed_internal::intinfo<bits>::next::int_t(l)) << precision) < r.value_bits; }
 
 /// @brief Greater than.
 /// @tparam bits The total number of bits for the base data type. Supported sizes are8, 16, 32, and 64.
@@ -380,7 +923,7 @@ template < uint32_t bits, uint32_t precision > inline bool operator<(typename cc
 /// @param l The left-hand side operand.
 /// @param r The right-hand side operand.
 /// @return The result.
-template < uint32_t bits, uint32_t precision > inline bool operator>(typename cc0::fixed_internal::intinfo<bits>::int_t l, cc0::fixed<bits,precision> r) { return (typename cc0::fixed_internal::intinfo<bits>::next::int_t(l) << precision) > r.value_bits; }
+template < uint32_t bits, uint32_t precision > inline constexpr bool operator>(typename cc0::fixed_internal::intinfo<bits>::int_t l, cc0::fixed<bits,precision> r) { return typename cc0::fixed_internal::intinfo<bits>::next::int_t(typename cc0::fixed_internal::intinfo<bits>::next::uint_t(typename cc0::fixed_internal::intinfo<bits>::next::int_t(l)) << precision) > r.value_bits; }
 
 /// @brief Less or equal.
 /// @tparam bits The total number of bits for the base data type. Supported sizes are8, 16, 32, and 64.
@@ -388,7 +931,7 @@ template < uint32_t bits, uint32_t precision > inline bool operator>(typename cc
 /// @param l The left-hand side operand.
 /// @param r The right-hand side operand.
 /// @return The result.
-template < uint32_t bits, uint32_t precision > inline bool operator<=(typename cc0::fixed_internal::intinfo<bits>::int_t l, cc0::fixed<bits,precision> r) { return (typename cc0::fixed_internal::intinfo<bits>::next::int_t(l) << precision) <= r.value_bits; }
+template < uint32_t bits, uint32_t precision > inline constexpr bool operator<=(typename cc0::fixed_internal::intinfo<bits>::int_t l, cc0::fixed<bits,precision> r) { return typename cc0::fixed_internal::intinfo<bits>::next::int_t(typename cc0::fixed_internal::intinfo<bits>::next::uint_t(typename cc0::fixed_internal::intinfo<bits>::next::int_t(l)) << precision) <= r.value_bits; }
 
 /// @brief Greater or equal.
 /// @tparam bits The total number of bits for the base data type. Supported sizes are8, 16, 32, and 64.
@@ -396,7 +939,7 @@ template < uint32_t bits, uint32_t precision > inline bool operator<=(typename c
 /// @param l The left-hand side operand.
 /// @param r The right-hand side operand.
 /// @return The result.
-template < uint32_t bits, uint32_t precision > inline bool operator>=(typename cc0::fixed_internal::intinfo<bits>::int_t l, cc0::fixed<bits,precision> r) { return (typename cc0::fixed_internal::intinfo<bits>::next::int_t(l) << precision) >= r.value_bits; }
+template < uint32_t bits, uint32_t precision > inline constexpr bool operator>=(typename cc0::fixed_internal::intinfo<bits>::int_t l, cc0::fixed<bits,precision> r) { return typename cc0::fixed_internal::intinfo<bits>::next::int_t(typename cc0::fixed_internal::intinfo<bits>::next::uint_t(typename cc0::fixed_internal::intinfo<bits>::next::int_t(l)) << precision) >= r.value_bits; }
 
 /// @brief Equality.
 /// @tparam bits The total number of bits for the base data type. Supported sizes are8, 16, 32, and 64.
@@ -404,7 +947,7 @@ template < uint32_t bits, uint32_t precision > inline bool operator>=(typename c
 /// @param l The left-hand side operand.
 /// @param r The right-hand side operand.
 /// @return The result.
-template < uint32_t bits, uint32_t precision > inline bool operator==(cc0::fixed<bits,precision> l, typename cc0::fixed_internal::intinfo<bits>::int_t r) { return l.value_bits == (typename cc0::fixed_internal::intinfo<bits>::next::int_t(r) << precision); }
+template < uint32_t bits, uint32_t precision > inline constexpr bool operator==(cc0::fixed<bits,precision> l, typename cc0::fixed_internal::intinfo<bits>::int_t r) { return l.value_bits == typename cc0::fixed_internal::intinfo<bits>::next::int_t(typename cc0::fixed_internal::intinfo<bits>::next::uint_t(typename cc0::fixed_internal::intinfo<bits>::next::int_t(r)) << precision); }
 
 /// @brief Inequality.
 /// @tparam bits The total number of bits for the base data type. Supported sizes are8, 16, 32, and 64.
@@ -412,7 +955,7 @@ template < uint32_t bits, uint32_t precision > inline bool operator==(cc0::fixed
 /// @param l The left-hand side operand.
 /// @param r The right-hand side operand.
 /// @return The result.
-template < uint32_t bits, uint32_t precision > inline bool operator!=(cc0::fixed<bits,precision> l, typename cc0::fixed_internal::intinfo<bits>::int_t r) { return l.value_bits != (typename cc0::fixed_internal::intinfo<bits>::next::int_t(r) << precision); }
+template < uint32_t bits, uint32_t precision > inline constexpr bool operator!=(cc0::fixed<bits,precision> l, typename cc0::fixed_internal::intinfo<bits>::int_t r) { return l.value_bits != typename cc0::fixed_internal::intinfo<bits>::next::int_t(typename cc0::fixed_internal::intinfo<bits>::next::uint_t(typename cc0::fixed_internal::intinfo<bits>::next::int_t(r)) << precision); }
 
 /// @brief Less than.
 /// @tparam bits The total number of bits for the base data type. Supported sizes are8, 16, 32, and 64.
@@ -420,7 +963,7 @@ template < uint32_t bits, uint32_t precision > inline bool operator!=(cc0::fixed
 /// @param l The left-hand side operand.
 /// @param r The right-hand side operand.
 /// @return The result.
-template < uint32_t bits, uint32_t precision > inline bool operator<(cc0::fixed<bits,precision> l, typename cc0::fixed_internal::intinfo<bits>::int_t r) { return l.value_bits < (typename cc0::fixed_internal::intinfo<bits>::next::int_t(r) << precision); }
+template < uint32_t bits, uint32_t precision > inline constexpr bool operator<(cc0::fixed<bits,precision> l, typename cc0::fixed_internal::intinfo<bits>::int_t r) { return l.value_bits < typename cc0::fixed_internal::intinfo<bits>::next::int_t(typename cc0::fixed_internal::intinfo<bits>::next::uint_t(typename cc0::fixed_internal::intinfo<bits>::next::int_t(r)) << precision); }
 
 /// @brief Greater than.
 /// @tparam bits The total number of bits for the base data type. Supported sizes are8, 16, 32, and 64.
@@ -428,7 +971,7 @@ template < uint32_t bits, uint32_t precision > inline bool operator<(cc0::fixed<
 /// @param l The left-hand side operand.
 /// @param r The right-hand side operand.
 /// @return The result.
-template < uint32_t bits, uint32_t precision > inline bool operator>(cc0::fixed<bits,precision> l, typename cc0::fixed_internal::intinfo<bits>::int_t r) { return l.value_bits > (typename cc0::fixed_internal::intinfo<bits>::next::int_t(r) << precision); }
+template < uint32_t bits, uint32_t precision > inline constexpr bool operator>(cc0::fixed<bits,precision> l, typename cc0::fixed_internal::intinfo<bits>::int_t r) { return l.value_bits > typename cc0::fixed_internal::intinfo<bits>::next::int_t(typename cc0::fixed_internal::intinfo<bits>::next::uint_t(typename cc0::fixed_internal::intinfo<bits>::next::int_t(r)) << precision); }
 
 /// @brief Less or equal.
 /// @tparam bits The total number of bits for the base data type. Supported sizes are8, 16, 32, and 64.
@@ -436,7 +979,7 @@ template < uint32_t bits, uint32_t precision > inline bool operator>(cc0::fixed<
 /// @param l The left-hand side operand.
 /// @param r The right-hand side operand.
 /// @return The result.
-template < uint32_t bits, uint32_t precision > inline bool operator<=(cc0::fixed<bits,precision> l, typename cc0::fixed_internal::intinfo<bits>::int_t r) { return l.value_bits <= (typename cc0::fixed_internal::intinfo<bits>::next::int_t(r) << precision); }
+template < uint32_t bits, uint32_t precision > inline constexpr bool operator<=(cc0::fixed<bits,precision> l, typename cc0::fixed_internal::intinfo<bits>::int_t r) { return l.value_bits <= typename cc0::fixed_internal::intinfo<bits>::next::int_t(typename cc0::fixed_internal::intinfo<bits>::next::uint_t(typename cc0::fixed_internal::intinfo<bits>::next::int_t(r)) << precision); }
 
 /// @brief Greater or equal.
 /// @tparam bits The total number of bits for the base data type. Supported sizes are8, 16, 32, and 64.
@@ -444,6 +987,6 @@ template < uint32_t bits, uint32_t precision > inline bool operator<=(cc0::fixed
 /// @param l The left-hand side operand.
 /// @param r The right-hand side operand.
 /// @return The result.
-template < uint32_t bits, uint32_t precision > inline bool operator>=(cc0::fixed<bits,precision> l, typename cc0::fixed_internal::intinfo<bits>::int_t r) { return l.value_bits >= (typename cc0::fixed_internal::intinfo<bits>::next::int_t(r) << precision); }
+template < uint32_t bits, uint32_t precision > inline constexpr bool operator>=(cc0::fixed<bits,precision> l, typename cc0::fixed_internal::intinfo<bits>::int_t r) { return l.value_bits >= typename cc0::fixed_internal::intinfo<bits>::next::int_t(typename cc0::fixed_internal::intinfo<bits>::next::uint_t(typename cc0::fixed_internal::intinfo<bits>::next::int_t(r)) << precision); }
 
 #endif
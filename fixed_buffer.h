@@ -0,0 +1,246 @@
+/// @file fixed_buffer.h
+/// @brief Contains a dynamic array for fixed-point numbers with 64-byte-aligned, vector-width-padded storage, so batch kernels always take their aligned full-width paths, plus an allocator hook for arena- or pool-backed allocations.
+/// @author github.com/SirJonthe
+/// @date 2025
+/// @copyright Public domain.
+/// @license CC0 1.0
+
+#ifndef CC0_FIXED_BUFFER_H_INCLUDED__
+#define CC0_FIXED_BUFFER_H_INCLUDED__
+
+#include <cstdint>
+#include <cstdlib>
+
+#include "fixed.h"
+
+namespace cc0
+{
+	/// @brief The signature of a raw allocation function used by fixed_buffer. Receives the number of bytes to allocate and returns the allocation, or null on failure. The buffer aligns within the allocation itself, so the function has no alignment obligations.
+	typedef void* (*fixed_buffer_alloc_t)(uint64_t size);
+
+	/// @brief The signature of a deallocation function used by fixed_buffer. Receives a pointer previously returned by the matching allocation function.
+	typedef void (*fixed_buffer_free_t)(void *ptr);
+
+	/// @brief For internal use only.
+	namespace fixed_internal
+	{
+		/// @brief The default allocation function. Allocates off the heap.
+		/// @param size The number of bytes to allocate.
+		/// @return The allocation, or null on failure.
+		inline void *default_buffer_alloc(uint64_t size)
+		{
+			return std::malloc(size_t(size));
+		}
+
+		/// @brief The default deallocation function. Returns the allocation to the heap.
+		/// @param ptr The allocation.
+		inline void default_buffer_free(void *ptr)
+		{
+			std::free(ptr);
+		}
+
+		/// @brief Accesses the currently installed allocation function.
+		/// @return A reference to the currently installed allocation function.
+		inline fixed_buffer_alloc_t &buffer_alloc( void )
+		{
+			static fixed_buffer_alloc_t fn = &default_buffer_alloc;
+			return fn;
+		}
+
+		/// @brief Accesses the currently installed deallocation function.
+		/// @return A reference to the currently installed deallocation function.
+		inline fixed_buffer_free_t &buffer_free( void )
+		{
+			static fixed_buffer_free_t fn = &default_buffer_free;
+			return fn;
+		}
+	}
+
+	/// @brief Installs an allocator for fixed_buffer storage, e.g. a frame-scoped arena or a pool. Buffers free through the deallocation function installed when they allocated, so swapping allocators while buffers are live is safe as long as the old functions outlive them.
+	/// @param alloc_fn The allocation function. Null restores the default heap allocator.
+	/// @param free_fn The deallocation function. Null restores the default heap deallocator.
+	inline void set_fixed_buffer_allocator(fixed_buffer_alloc_t alloc_fn, fixed_buffer_free_t free_fn)
+	{
+		cc0::fixed_internal::buffer_alloc() = alloc_fn != nullptr ? alloc_fn : &cc0::fixed_internal::default_buffer_alloc;
+		cc0::fixed_internal::buffer_free()  = free_fn != nullptr ? free_fn : &cc0::fixed_internal::default_buffer_free;
+	}
+
+	/// @brief A dynamic array of fixed-point numbers whose storage starts on a 64-byte boundary and whose capacity is padded to a whole number of 64-byte lines, so vector kernels can load and store full aligned registers over the entire array, tail included. The padding elements are storage only and are never initialized. Elements are stored contiguously with the same layout as a plain fixed array, so the storage passes directly to the batch facilities, and data_bits exposes it as the bare integer representations for raw kernels.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	template < uint32_t bits, uint32_t precision >
+	class fixed_buffer
+	{
+	private:
+		typedef typename cc0::fixed_internal::intinfo<bits>::int_t int_t;
+
+		static constexpr uint64_t ALIGN    = 64;                   // The alignment of the storage in bytes, i.e. one cache line, which covers every vector width up to 512 bits.
+		static constexpr uint64_t PER_LINE = ALIGN / (bits / 8);   // The number of elements per 64-byte line, which capacities are rounded up to.
+
+	private:
+		void                        *m_raw;      // The unaligned allocation, as returned by the allocation function.
+		cc0::fixed<bits,precision>  *m_data;     // The elements, aligned within the allocation.
+		uint64_t                     m_size;     // The number of elements.
+		uint64_t                     m_capacity; // The number of elements the storage holds, always a multiple of PER_LINE.
+		cc0::fixed_buffer_free_t     m_free;     // The deallocation function matching the allocation, captured at allocation time.
+
+		/// @brief Allocates aligned storage for a number of elements, padded up to whole lines. The members are only touched when the allocation succeeds, so the buffer is unchanged on failure.
+		/// @param capacity The number of elements, already rounded up to a multiple of PER_LINE.
+		/// @return True on success. False when the allocation function returned null, e.g. on arena exhaustion.
+		bool allocate(uint64_t capacity)
+		{
+			void *raw = cc0::fixed_internal::buffer_alloc()(capacity * (bits / 8) + (ALIGN - 1));
+			if (raw == nullptr) {
+				return false;
+			}
+			m_raw      = raw;
+			m_data     = reinterpret_cast<cc0::fixed<bits,precision>*>((uintptr_t(raw) + (ALIGN - 1)) & ~uintptr_t(ALIGN - 1));
+			m_capacity = capacity;
+			m_free     = cc0::fixed_internal::buffer_free();
+			return true;
+		}
+
+		/// @brief Releases the storage.
+		void release( void )
+		{
+			if (m_raw != nullptr) {
+				m_free(m_raw);
+			}
+			m_raw      = nullptr;
+			m_data     = nullptr;
+			m_capacity = 0;
+		}
+
+		/// @brief Rounds an element count up to a whole number of lines.
+		/// @param size The number of elements.
+		/// @return The padded number of elements.
+		static constexpr uint64_t padded(uint64_t size) { return (size + (PER_LINE - 1)) & ~(PER_LINE - 1); }
+
+	public:
+		/// @brief Constructs an empty buffer without allocating.
+		fixed_buffer( void ) : m_raw(nullptr), m_data(nullptr), m_size(0), m_capacity(0), m_free(nullptr) {}
+
+		/// @brief Constructs a buffer holding a number of elements. The elements are not initialized. The buffer is left empty when the allocation fails, observable via size.
+		/// @param size The number of elements.
+		explicit fixed_buffer(uint64_t size) : fixed_buffer() { resize(size); }
+
+		/// @brief Copies a buffer, element by element into freshly allocated storage. The buffer is left empty when the allocation fails, observable via size.
+		/// @param b The buffer to copy.
+		fixed_buffer(const fixed_buffer &b) : fixed_buffer() {
+			if (resize(b.m_size)) {
+				for (uint64_t i = 0; i < m_size; ++i) { m_data[i] = b.m_data[i]; }
+			}
+		}
+
+		/// @brief Takes over the storage of another buffer, leaving it empty.
+		/// @param b The buffer to take the storage from.
+		fixed_buffer(fixed_buffer &&b) : m_raw(b.m_raw), m_data(b.m_data), m_size(b.m_size), m_capacity(b.m_capacity), m_free(b.m_free) {
+			b.m_raw      = nullptr;
+			b.m_data     = nullptr;
+			b.m_size     = 0;
+			b.m_capacity = 0;
+		}
+
+		/// @brief Releases the storage.
+		~fixed_buffer( void ) { release(); }
+
+		/// @brief Copies a buffer, element by element. The buffer is left unchanged when the allocation fails.
+		/// @param b The buffer to copy.
+		/// @return A reference to self.
+		fixed_buffer &operator=(const fixed_buffer &b)
+		{
+			if (this != &b && resize(b.m_size)) {
+				for (uint64_t i = 0; i < m_size; ++i) { m_data[i] = b.m_data[i]; }
+			}
+			return *this;
+		}
+
+		/// @brief Takes over the storage of another buffer, leaving it empty.
+		/// @param b The buffer to take the storage from.
+		/// @return A reference to self.
+		fixed_buffer &operator=(fixed_buffer &&b)
+		{
+			if (this != &b) {
+				release();
+				m_raw      = b.m_raw;
+				m_data     = b.m_data;
+				m_size     = b.m_size;
+				m_capacity = b.m_capacity;
+				m_free     = b.m_free;
+				b.m_raw      = nullptr;
+				b.m_data     = nullptr;
+				b.m_size     = 0;
+				b.m_capacity = 0;
+			}
+			return *this;
+		}
+
+		/// @brief Grows the storage to hold at least a number of elements, preserving the contents. Does nothing when the storage is already large enough.
+		/// @param capacity The number of elements. Rounded up to a whole number of 64-byte lines.
+		/// @return True on success. The buffer is left unchanged when the allocation fails, so a later call can retry, e.g. after the arena is reset.
+		bool reserve(uint64_t capacity)
+		{
+			if (padded(capacity) > m_capacity) {
+				void                       *old_raw  = m_raw;
+				cc0::fixed<bits,precision> *old_data = m_data;
+				cc0::fixed_buffer_free_t    old_free = m_free;
+				if (!allocate(padded(capacity))) {
+					return false;
+				}
+				for (uint64_t i = 0; i < m_size; ++i) { m_data[i] = old_data[i]; }
+				if (old_raw != nullptr) {
+					old_free(old_raw);
+				}
+			}
+			return true;
+		}
+
+		/// @brief Changes the number of elements, preserving the contents up to the smaller of the old and new sizes. Elements past the old size are not initialized.
+		/// @param size The number of elements.
+		/// @return True on success. The buffer is left unchanged when the allocation fails.
+		bool resize(uint64_t size)
+		{
+			if (!reserve(size)) {
+				return false;
+			}
+			m_size = size;
+			return true;
+		}
+
+		/// @brief The number of elements.
+		/// @return The number of elements.
+		uint64_t size( void ) const { return m_size; }
+
+		/// @brief The number of elements the storage holds without reallocating, always a whole number of 64-byte lines.
+		/// @return The number of elements the storage holds.
+		uint64_t capacity( void ) const { return m_capacity; }
+
+		/// @brief The elements, starting on a 64-byte boundary.
+		/// @return A pointer to the elements.
+		cc0::fixed<bits,precision> *data( void ) { return m_data; }
+
+		/// @brief The elements, starting on a 64-byte boundary.
+		/// @return A pointer to the elements.
+		const cc0::fixed<bits,precision> *data( void ) const { return m_data; }
+
+		/// @brief The bare bit representations of the elements, for raw kernel access. Same storage as data, reinterpreted through the layout guarantee that a fixed-point number is exactly its bit representation.
+		/// @return A pointer to the bit representations.
+		int_t *data_bits( void ) { return reinterpret_cast<int_t*>(m_data); }
+
+		/// @brief The bare bit representations of the elements, for raw kernel access. Same storage as data, reinterpreted through the layout guarantee that a fixed-point number is exactly its bit representation.
+		/// @return A pointer to the bit representations.
+		const int_t *data_bits( void ) const { return reinterpret_cast<const int_t*>(m_data); }
+
+		/// @brief Accesses an element.
+		/// @param i The index of the element.
+		/// @return A reference to the element.
+		cc0::fixed<bits,precision> &operator[](uint64_t i) { return m_data[i]; }
+
+		/// @brief Accesses an element.
+		/// @param i The index of the element.
+		/// @return The element.
+		cc0::fixed<bits,precision> operator[](uint64_t i) const { return m_data[i]; }
+	};
+}
+
+#endif
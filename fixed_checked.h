@@ -0,0 +1,370 @@
+/// @file fixed_checked.h
+/// @brief Contains an overflow-detecting variant of the fixed-point data type that produces the same values as the plain type but invokes a user-installable handler whenever an operation wraps.
+/// @author github.com/SirJonthe
+/// @date 2025
+/// @copyright Public domain.
+/// @license CC0 1.0
+
+#ifndef CC0_FIXED_CHECKED_H_INCLUDED__
+#define CC0_FIXED_CHECKED_H_INCLUDED__
+
+#include <cstdint>
+#include <cstdio>
+
+#include "fixed.h"
+
+namespace cc0
+{
+	/// @brief The type of the handler invoked when a checked operation overflows.
+	/// @param op The name of the operation that overflowed, e.g. "mul".
+	typedef void (*fixed_checked_handler_t)(const char *op);
+
+	/// @brief For internal use only.
+	namespace fixed_internal
+	{
+		/// @brief The default overflow handler. Reports the operation to the standard error stream and carries on with the wrapped value.
+		/// @param op The name of the operation that overflowed.
+		inline void default_checked_handler(const char *op)
+		{
+			fprintf(stderr, "fixed_checked: overflow in %s\n", op);
+		}
+
+		/// @brief Accesses the installed overflow handler.
+		/// @return A reference to the installed overflow handler.
+		inline fixed_checked_handler_t &checked_handler( void )
+		{
+			static fixed_checked_handler_t handler = &default_checked_handler;
+			return handler;
+		}
+
+		/// @brief Overflow-detecting arithmetic on fixed-point bit representations. Every operation returns exactly the value the plain operators produce and additionally reports whether the widened intermediate fit before narrowing.
+		/// @tparam bits The number of bits of the base data type.
+		template < uint32_t bits >
+		struct check_ops
+		{
+			typedef typename intinfo<bits>::int_t        int_t;
+			typedef typename intinfo<bits>::uint_t       uint_t;
+			typedef typename intinfo<bits>::next::int_t  wide_t;
+
+			/// @brief Checked addition.
+			/// @param a The left-hand side bit representation.
+			/// @param b The right-hand side bit representation.
+			/// @param ovf Set to true when the sum does not fit the base type. Left untouched otherwise.
+			/// @return The wrapped sum, identical to what the plain operator produces.
+			static int_t add(int_t a, int_t b, bool &ovf) {
+				const wide_t s = wide_t(a) + b;
+				if (s != wide_t(int_t(uint_t(s)))) { ovf = true; }
+				return int_t(uint_t(s));
+			}
+
+			/// @brief Checked subtraction.
+			/// @param a The left-hand side bit representation.
+			/// @param b The right-hand side bit representation.
+			/// @param ovf Set to true when the difference does not fit the base type. Left untouched otherwise.
+			/// @return The wrapped difference, identical to what the plain operator produces.
+			static int_t sub(int_t a, int_t b, bool &ovf) {
+				const wide_t s = wide_t(a) - b;
+				if (s != wide_t(int_t(uint_t(s)))) { ovf = true; }
+				return int_t(uint_t(s));
+			}
+
+			/// @brief Checked fixed-point multiplication.
+			/// @param a The left-hand side bit representation.
+			/// @param b The right-hand side bit representation.
+			/// @param precision The number of bits dedicated to decimals.
+			/// @param ovf Set to true when the downscaled product does not fit the base type. Left untouched otherwise.
+			/// @return The wrapped, downscaled product, identical to what the plain operator produces.
+			static int_t mul(int_t a, int_t b, uint32_t precision, bool &ovf) {
+				const wide_t n = (wide_t(a) * b) >> precision;
+				if (n != wide_t(int_t(uint_t(n)))) { ovf = true; }
+				return int_t(uint_t(n));
+			}
+
+			/// @brief Checked fixed-point division.
+			/// @param a The left-hand side bit representation.
+			/// @param b The right-hand side bit representation.
+			/// @param precision The number of bits dedicated to decimals.
+			/// @param ovf Set to true when the upscaled quotient does not fit the base type. Left untouched otherwise.
+			/// @return The wrapped, upscaled quotient, identical to what the plain operator produces.
+			static int_t div(int_t a, int_t b, uint32_t precision, bool &ovf) {
+				const wide_t n = (wide_t(a) << precision) / b;
+				if (n != wide_t(int_t(uint_t(n)))) { ovf = true; }
+				return int_t(uint_t(n));
+			}
+		};
+
+		/// @brief Overflow-detecting arithmetic on 64-bit fixed-point bit representations. There is no wider base type, so overflow is detected through sign analysis and the 128-bit product helpers.
+		template <>
+		struct check_ops<64>
+		{
+			typedef int64_t int_t;
+
+			/// @brief Checked addition.
+			/// @param a The left-hand side bit representation.
+			/// @param b The right-hand side bit representation.
+			/// @param ovf Set to true when the sum does not fit the base type. Left untouched otherwise.
+			/// @return The wrapped sum, identical to what the plain operator produces.
+			static int_t add(int_t a, int_t b, bool &ovf) {
+				const int_t r = int_t(uint64_t(a) + uint64_t(b));
+				if (((a ^ r) & (b ^ r)) < 0) { ovf = true; }
+				return r;
+			}
+
+			/// @brief Checked subtraction.
+			/// @param a The left-hand side bit representation.
+			/// @param b The right-hand side bit representation.
+			/// @param ovf Set to true when the difference does not fit the base type. Left untouched otherwise.
+			/// @return The wrapped difference, identical to what the plain operator produces.
+			static int_t sub(int_t a, int_t b, bool &ovf) {
+				const int_t r = int_t(uint64_t(a) - uint64_t(b));
+				if (((a ^ b) & (a ^ r)) < 0) { ovf = true; }
+				return r;
+			}
+
+			/// @brief Checked fixed-point multiplication.
+			/// @param a The left-hand side bit representation.
+			/// @param b The right-hand side bit representation.
+			/// @param precision The number of bits dedicated to decimals.
+			/// @param ovf Set to true when the 64-bit intermediate product wraps, i.e. exactly when the plain operator silently truncates. Left untouched otherwise.
+			/// @return The wrapped, downscaled product, identical to what the plain operator produces.
+			static int_t mul(int_t a, int_t b, uint32_t precision, bool &ovf) {
+				int64_t  hi;
+				uint64_t lo;
+				imul128(a, b, hi, lo);
+				if (hi != (int64_t(lo) >> 63)) { ovf = true; }
+				return int64_t(lo) >> precision;
+			}
+
+			/// @brief Checked fixed-point division.
+			/// @param a The left-hand side bit representation.
+			/// @param b The right-hand side bit representation.
+			/// @param precision The number of bits dedicated to decimals.
+			/// @param ovf Set to true when the upscaled dividend or the quotient does not fit the base type. Left untouched otherwise.
+			/// @return The wrapped, upscaled quotient, identical to what the plain operator produces.
+			static int_t div(int_t a, int_t b, uint32_t precision, bool &ovf) {
+				const int_t n = int_t(uint64_t(a) << precision);
+				if ((n >> precision) != a || (a == INT64_MIN && b == -1)) {
+					ovf = true;
+				}
+				return a == INT64_MIN && b == -1 ? a : n / b;
+			}
+		};
+	}
+
+	/// @brief Installs the handler invoked when a checked operation overflows.
+	/// @param handler The handler to install. The default handler reports to the standard error stream and carries on with the wrapped value; an installed handler may instead abort, throw, or record.
+	/// @return The previously installed handler.
+	inline fixed_checked_handler_t set_fixed_checked_handler(fixed_checked_handler_t handler)
+	{
+		fixed_checked_handler_t prev = cc0::fixed_internal::checked_handler();
+		cc0::fixed_internal::checked_handler() = handler;
+		return prev;
+	}
+
+	/// @brief A fixed-point number whose arithmetic produces exactly the values of the plain type but invokes the installed handler whenever an operation wraps. Layout-compatible with fixed, i.e. a single value_bits member, so buffers can be reinterpreted between the two.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	template < uint32_t bits, uint32_t precision >
+	class fixed_checked
+	{
+	private:
+		typedef typename cc0::fixed_internal::intinfo<bits>::int_t  int_t;
+		typedef typename cc0::fixed_internal::intinfo<bits>::uint_t uint_t;
+		typedef cc0::fixed_internal::check_ops<bits>                ops;
+
+	public:
+		int_t value_bits; // The binary representation of the fixed-point number.
+
+		/// @brief The default constructor. Does nothing, and does not initialize the instance.
+		fixed_checked( void ) = default;
+
+		/// @brief The copy constructor.
+		/// @param NA The instance to copy.
+		fixed_checked(const fixed_checked&) = default;
+
+		/// @brief The copy operator.
+		/// @param NA The instance to copy.
+		/// @return The result.
+		fixed_checked &operator=(const fixed_checked&) = default;
+
+		/// @brief A conversion constructor that converts an integer into a fixed-point number by upscaling it, invoking the handler when the upscaled value wraps.
+		/// @param n The number to upscale into a fixed-point number.
+		fixed_checked(int_t n) : value_bits(int_t(uint_t(n) << precision)) {
+			if ((value_bits >> precision) != n) {
+				cc0::fixed_internal::checked_handler()("int");
+			}
+		}
+
+		/// @brief Converts two integers into a fixed-point number.
+		/// @param i The integer part of the number.
+		/// @param d The fractional part of the number in base 10.
+		/// @note The fractional parameter is scaled properly, meaning 9 is the same as 90, 900, 9000, etc.
+		fixed_checked(int_t i, uint_t d) : value_bits(cc0::fixed<bits,precision>(i, d).value_bits) {}
+
+		/// @brief A conversion constructor reinterpreting a plain fixed-point number.
+		/// @param f The fixed-point number.
+		explicit fixed_checked(cc0::fixed<bits,precision> f) : value_bits(f.value_bits) {}
+
+		/// @brief A conversion operator reinterpreting the number as a plain fixed-point number.
+		operator cc0::fixed<bits,precision>( void ) const {
+			cc0::fixed<bits,precision> out;
+			out.value_bits = value_bits;
+			return out;
+		}
+
+		/// @brief A conversion operator converting the fixed-point number into an integer by downscaling it.
+		explicit operator int_t( void ) const { return value_bits >> precision; }
+
+		/// @brief Checked addition.
+		/// @param r The right-hand side operator.
+		/// @return The result.
+		fixed_checked &operator+=(fixed_checked r) {
+			bool ovf = false;
+			value_bits = ops::add(value_bits, r.value_bits, ovf);
+			if (ovf) { cc0::fixed_internal::checked_handler()("add"); }
+			return *this;
+		}
+
+		/// @brief Checked subtraction.
+		/// @param r The right-hand side operator.
+		/// @return The result.
+		fixed_checked &operator-=(fixed_checked r) {
+			bool ovf = false;
+			value_bits = ops::sub(value_bits, r.value_bits, ovf);
+			if (ovf) { cc0::fixed_internal::checked_handler()("sub"); }
+			return *this;
+		}
+
+		/// @brief Checked multiplication.
+		/// @param r The right-hand side operator.
+		/// @return The result.
+		fixed_checked &operator*=(fixed_checked r) {
+			bool ovf = false;
+			value_bits = ops::mul(value_bits, r.value_bits, precision, ovf);
+			if (ovf) { cc0::fixed_internal::checked_handler()("mul"); }
+			return *this;
+		}
+
+		/// @brief Checked division.
+		/// @param r The right-hand side operator.
+		/// @return The result.
+		fixed_checked &operator/=(fixed_checked r) {
+			bool ovf = false;
+			value_bits = ops::div(value_bits, r.value_bits, precision, ovf);
+			if (ovf) { cc0::fixed_internal::checked_handler()("div"); }
+			return *this;
+		}
+
+		/// @brief Pre-increment.
+		/// @return A reference to the state of the variable after increment.
+		fixed_checked &operator++( void ) { return *this += fixed_checked(int_t(1)); }
+
+		/// @brief Post-increment.
+		/// @return The state of the variable before increment.
+		fixed_checked operator++( int ) { auto t = *this; *this += fixed_checked(int_t(1)); return t; }
+
+		/// @brief Pre-decrement.
+		/// @return A reference to the state of the variable after decrement.
+		fixed_checked &operator--( void ) { return *this -= fixed_checked(int_t(1)); }
+
+		/// @brief Post-decrement.
+		/// @return The state of the variable before decrement.
+		fixed_checked operator--( int ) { auto t = *this; *this -= fixed_checked(int_t(1)); return t; }
+	};
+
+#if defined(CC0_FIXED_CHECKED)
+	/// @brief The project-wide fixed-point type. Aliases the checked variant since CC0_FIXED_CHECKED is defined, so debug builds get overflow diagnostics from the same source.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	template < uint32_t bits, uint32_t precision >
+	using fixed_t = fixed_checked<bits,precision>;
+#else
+	/// @brief The project-wide fixed-point type. Aliases the plain type since CC0_FIXED_CHECKED is not defined, so release builds compile to exactly the instructions the plain type emits.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	template < uint32_t bits, uint32_t precision >
+	using fixed_t = fixed<bits,precision>;
+#endif
+}
+
+/// @brief Checked addition.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline cc0::fixed_checked<bits,precision> operator+(cc0::fixed_checked<bits,precision> l, cc0::fixed_checked<bits,precision> r) { return l += r; }
+
+/// @brief Checked subtraction.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline cc0::fixed_checked<bits,precision> operator-(cc0::fixed_checked<bits,precision> l, cc0::fixed_checked<bits,precision> r) { return l -= r; }
+
+/// @brief Checked multiplication.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline cc0::fixed_checked<bits,precision> operator*(cc0::fixed_checked<bits,precision> l, cc0::fixed_checked<bits,precision> r) { return l *= r; }
+
+/// @brief Checked division.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline cc0::fixed_checked<bits,precision> operator/(cc0::fixed_checked<bits,precision> l, cc0::fixed_checked<bits,precision> r) { return l /= r; }
+
+/// @brief Equality.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline bool operator==(cc0::fixed_checked<bits,precision> l, cc0::fixed_checked<bits,precision> r) { return l.value_bits == r.value_bits; }
+
+/// @brief Inequality.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline bool operator!=(cc0::fixed_checked<bits,precision> l, cc0::fixed_checked<bits,precision> r) { return l.value_bits != r.value_bits; }
+
+/// @brief Less than.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline bool operator<(cc0::fixed_checked<bits,precision> l, cc0::fixed_checked<bits,precision> r) { return l.value_bits < r.value_bits; }
+
+/// @brief Greater than.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline bool operator>(cc0::fixed_checked<bits,precision> l, cc0::fixed_checked<bits,precision> r) { return l.value_bits > r.value_bits; }
+
+/// @brief Less or equal.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline bool operator<=(cc0::fixed_checked<bits,precision> l, cc0::fixed_checked<bits,precision> r) { return l.value_bits <= r.value_bits; }
+
+/// @brief Greater or equal.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline bool operator>=(cc0::fixed_checked<bits,precision> l, cc0::fixed_checked<bits,precision> r) { return l.value_bits >= r.value_bits; }
+
+#endif
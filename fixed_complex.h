@@ -0,0 +1,184 @@
+/// @file fixed_complex.h
+/// @brief Contains a complex number type over fixed-point components, stored interleaved so arrays of complex numbers are laid out exactly like arrays of real/imaginary bit-representation pairs.
+/// @author github.com/SirJonthe
+/// @date 2025
+/// @copyright Public domain.
+/// @license CC0 1.0
+
+#ifndef CC0_FIXED_COMPLEX_H_INCLUDED__
+#define CC0_FIXED_COMPLEX_H_INCLUDED__
+
+#include <cstdint>
+
+#include "fixed.h"
+#include "fixed_simd.h"
+
+namespace cc0
+{
+	/// @brief A complex number with fixed-point real and imaginary parts, stored adjacently. An array of complex numbers is therefore an interleaved buffer of bit-representation pairs with no padding, so existing capture formats can be reinterpreted in place.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @note For 64-bit base types the widened intermediate aliases the base type, so products may silently truncate just like operator*.
+	template < uint32_t bits, uint32_t precision >
+	class fixed_complex
+	{
+	private:
+		typedef typename cc0::fixed_internal::intinfo<bits>::int_t       int_t;
+		typedef typename cc0::fixed_internal::intinfo<bits>::next::int_t wide_t;
+
+	public:
+		cc0::fixed<bits,precision> re; // The real part.
+		cc0::fixed<bits,precision> im; // The imaginary part.
+
+		/// @brief The default constructor. Does nothing, and does not initialize the instance.
+		fixed_complex( void ) = default;
+
+		/// @brief The copy constructor.
+		/// @param NA The instance to copy.
+		fixed_complex(const fixed_complex&) = default;
+
+		/// @brief The copy operator.
+		/// @param NA The instance to copy.
+		/// @return The result.
+		fixed_complex &operator=(const fixed_complex&) = default;
+
+		/// @brief Constructs a complex number from its parts.
+		/// @param r The real part.
+		/// @param i The imaginary part.
+		constexpr fixed_complex(cc0::fixed<bits,precision> r, cc0::fixed<bits,precision> i) : re(r), im(i) {}
+
+		/// @brief A conversion constructor that converts a real number into a complex number with a zero imaginary part.
+		/// @param r The real part.
+		constexpr fixed_complex(cc0::fixed<bits,precision> r) : re(r), im(cc0::fixed<bits,precision>::from_bits(0)) {}
+
+		/// @brief Addition.
+		/// @param r The right-hand side operator.
+		/// @return The result.
+		CC0_FIXED_CONSTEXPR fixed_complex &operator+=(fixed_complex r) { re += r.re; im += r.im; return *this; }
+
+		/// @brief Subtraction.
+		/// @param r The right-hand side operator.
+		/// @return The result.
+		CC0_FIXED_CONSTEXPR fixed_complex &operator-=(fixed_complex r) { re -= r.re; im -= r.im; return *this; }
+
+		/// @brief Multiplication, in the three-multiply Karatsuba form. The three products and their sums stay in the widened intermediate, so only two downscaling shifts are paid per complex product instead of four multiplies and four shifts.
+		/// @param r The right-hand side operator.
+		/// @return The result.
+		CC0_FIXED_CONSTEXPR fixed_complex &operator*=(fixed_complex r) {
+			const wide_t k1 = wide_t(r.re.value_bits) * (wide_t(re.value_bits) + wide_t(im.value_bits));
+			const wide_t k2 = wide_t(re.value_bits) * (wide_t(r.im.value_bits) - wide_t(r.re.value_bits));
+			const wide_t k3 = wide_t(im.value_bits) * (wide_t(r.re.value_bits) + wide_t(r.im.value_bits));
+			re.value_bits = int_t((k1 - k3) >> precision);
+			im.value_bits = int_t((k1 + k2) >> precision);
+			return *this;
+		}
+
+		/// @brief Scaling by a real number.
+		/// @param r The right-hand side operator.
+		/// @return The result.
+		CC0_FIXED_CONSTEXPR fixed_complex &operator*=(cc0::fixed<bits,precision> r) { re *= r; im *= r; return *this; }
+
+		/// @brief The complex conjugate.
+		/// @return The conjugate.
+		CC0_FIXED_CONSTEXPR fixed_complex conj( void ) const {
+			fixed_complex out;
+			out.re = re;
+			out.im.value_bits = int_t(-im.value_bits);
+			return out;
+		}
+
+		/// @brief The squared magnitude, with both squares kept in the widened intermediate and one downscaling shift at the end.
+		/// @return The squared magnitude.
+		CC0_FIXED_CONSTEXPR cc0::fixed<bits,precision> abs2( void ) const {
+			cc0::fixed<bits,precision> out;
+			out.value_bits = int_t((wide_t(re.value_bits) * re.value_bits + wide_t(im.value_bits) * im.value_bits) >> precision);
+			return out;
+		}
+	};
+
+	/// @brief Batch kernels operating on contiguous arrays of fixed-point numbers.
+	namespace fixed_simd
+	{
+		/// @brief Adds two interleaved arrays of complex fixed-point numbers element by element.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param dst The destination array. May alias a or b.
+		/// @param a The left-hand side array.
+		/// @param b The right-hand side array.
+		/// @param n The number of elements to process.
+		template < uint32_t bits, uint32_t precision >
+		void add(cc0::fixed_complex<bits,precision> *dst, const cc0::fixed_complex<bits,precision> *a, const cc0::fixed_complex<bits,precision> *b, uint64_t n)
+		{
+			for (uint64_t i = 0; i < n; ++i) {
+				dst[i] = a[i];
+				dst[i] += b[i];
+			}
+		}
+
+		/// @brief Multiplies two interleaved arrays of complex fixed-point numbers element by element in the three-multiply form.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param dst The destination array. May alias a or b.
+		/// @param a The left-hand side array.
+		/// @param b The right-hand side array.
+		/// @param n The number of elements to process.
+		template < uint32_t bits, uint32_t precision >
+		void mul(cc0::fixed_complex<bits,precision> *dst, const cc0::fixed_complex<bits,precision> *a, const cc0::fixed_complex<bits,precision> *b, uint64_t n)
+		{
+			for (uint64_t i = 0; i < n; ++i) {
+				dst[i] = a[i];
+				dst[i] *= b[i];
+			}
+		}
+	}
+}
+
+/// @brief Addition.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline CC0_FIXED_CONSTEXPR cc0::fixed_complex<bits,precision> operator+(cc0::fixed_complex<bits,precision> l, cc0::fixed_complex<bits,precision> r) { return l += r; }
+
+/// @brief Subtraction.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline CC0_FIXED_CONSTEXPR cc0::fixed_complex<bits,precision> operator-(cc0::fixed_complex<bits,precision> l, cc0::fixed_complex<bits,precision> r) { return l -= r; }
+
+/// @brief Multiplication.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline CC0_FIXED_CONSTEXPR cc0::fixed_complex<bits,precision> operator*(cc0::fixed_complex<bits,precision> l, cc0::fixed_complex<bits,precision> r) { return l *= r; }
+
+/// @brief Scaling by a real number.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline CC0_FIXED_CONSTEXPR cc0::fixed_complex<bits,precision> operator*(cc0::fixed_complex<bits,precision> l, cc0::fixed<bits,precision> r) { return l *= r; }
+
+/// @brief Equality.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline constexpr bool operator==(cc0::fixed_complex<bits,precision> l, cc0::fixed_complex<bits,precision> r) { return l.re == r.re && l.im == r.im; }
+
+/// @brief Inequality.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline constexpr bool operator!=(cc0::fixed_complex<bits,precision> l, cc0::fixed_complex<bits,precision> r) { return l.re != r.re || l.im != r.im; }
+
+#endif
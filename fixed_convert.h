@@ -0,0 +1,101 @@
+/// @file fixed_convert.h
+/// @brief Contains bulk conversion between buffers of floating-point numbers and buffers of fixed-point numbers. The core library stays float-free; this header is the one boundary where floats enter and leave, written as chunked loops of multiply-and-convert that the vectorizer lowers to packed convert instructions.
+/// @author github.com/SirJonthe
+/// @date 2025
+/// @copyright Public domain.
+/// @license CC0 1.0
+
+#ifndef CC0_FIXED_CONVERT_H_INCLUDED__
+#define CC0_FIXED_CONVERT_H_INCLUDED__
+
+#include <cstdint>
+
+#include "fixed.h"
+
+namespace cc0
+{
+	/// @brief For internal use only.
+	namespace fixed_internal
+	{
+		/// @brief The extreme base type values as floats, for clamping before conversion. The upper bound is the largest float strictly below the first out-of-range value, since the nearest float to the maximum itself rounds up and out of range for the 32- and 64-bit types.
+		/// @tparam bits The number of bits of the base data type.
+		template < uint32_t bits > struct float_limits {};
+		template <> struct float_limits<8>  { static constexpr float lo( void ) { return -128.0f; }                   static constexpr float hi( void ) { return 127.0f; } };
+		template <> struct float_limits<16> { static constexpr float lo( void ) { return -32768.0f; }                 static constexpr float hi( void ) { return 32767.0f; } };
+		template <> struct float_limits<32> { static constexpr float lo( void ) { return -2147483648.0f; }            static constexpr float hi( void ) { return 2147483520.0f; } };
+		template <> struct float_limits<64> { static constexpr float lo( void ) { return -9223372036854775808.0f; }   static constexpr float hi( void ) { return 9223371487098961920.0f; } };
+	}
+
+	/// @brief Bulk conversion between floating-point and fixed-point buffers. The loops process cache-sized chunks with no per-element branches or calls, so the compiler emits packed convert-and-shift sequences and a streaming consumer can follow one chunk behind.
+	namespace fixed_convert
+	{
+		/// @brief For internal use only.
+		namespace internal
+		{
+			static constexpr uint64_t CHUNK = 1024; // The number of elements converted per chunk. Source and destination chunks together stay well within the first-level cache.
+		}
+
+		/// @brief Converts a buffer of floats into a buffer of fixed-point numbers by scaling and truncating, i.e. the same rounding the arithmetic operators use.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param dst The destination buffer. May alias src only if the element sizes match exactly.
+		/// @param src The source buffer.
+		/// @param n The number of elements to convert.
+		/// @note Values outside the representable range, infinities, and NaN convert to unspecified results, exactly as a scalar cast would. Use from_float_clamped when the input is not trusted to be in range.
+		template < uint32_t bits, uint32_t precision >
+		void from_float(cc0::fixed<bits,precision> *dst, const float *src, uint64_t n)
+		{
+			typedef typename cc0::fixed_internal::intinfo<bits>::int_t int_t;
+			const float scale = float(uint64_t(1) << precision);
+			for (uint64_t c = 0; c < n; c += internal::CHUNK) {
+				const uint64_t end = c + internal::CHUNK < n ? c + internal::CHUNK : n;
+				for (uint64_t i = c; i < end; ++i) {
+					dst[i].value_bits = int_t(src[i] * scale);
+				}
+			}
+		}
+
+		/// @brief Converts a buffer of floats into a buffer of fixed-point numbers, clamping out-of-range values to the extremes the same way the saturating type does. The clamp is a pair of float min/max operations per element, so the loop stays branchless and packed.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param dst The destination buffer. May alias src only if the element sizes match exactly.
+		/// @param src The source buffer.
+		/// @param n The number of elements to convert.
+		/// @note NaN converts to an unspecified in-range value.
+		template < uint32_t bits, uint32_t precision >
+		void from_float_clamped(cc0::fixed<bits,precision> *dst, const float *src, uint64_t n)
+		{
+			typedef typename cc0::fixed_internal::intinfo<bits>::int_t int_t;
+			const float scale = float(uint64_t(1) << precision);
+			const float lo = cc0::fixed_internal::float_limits<bits>::lo();
+			const float hi = cc0::fixed_internal::float_limits<bits>::hi();
+			for (uint64_t c = 0; c < n; c += internal::CHUNK) {
+				const uint64_t end = c + internal::CHUNK < n ? c + internal::CHUNK : n;
+				for (uint64_t i = c; i < end; ++i) {
+					const float x = src[i] * scale;
+					dst[i].value_bits = int_t(x < lo ? lo : (x > hi ? hi : x));
+				}
+			}
+		}
+
+		/// @brief Converts a buffer of fixed-point numbers into a buffer of floats. The scale factor is a power of two so the multiply is exact; the only rounding is the conversion of the bit representation itself to float.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param dst The destination buffer. May alias src only if the element sizes match exactly.
+		/// @param src The source buffer.
+		/// @param n The number of elements to convert.
+		template < uint32_t bits, uint32_t precision >
+		void to_float(float *dst, const cc0::fixed<bits,precision> *src, uint64_t n)
+		{
+			const float scale = 1.0f / float(uint64_t(1) << precision);
+			for (uint64_t c = 0; c < n; c += internal::CHUNK) {
+				const uint64_t end = c + internal::CHUNK < n ? c + internal::CHUNK : n;
+				for (uint64_t i = c; i < end; ++i) {
+					dst[i] = float(src[i].value_bits) * scale;
+				}
+			}
+		}
+	}
+}
+
+#endif
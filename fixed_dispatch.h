@@ -0,0 +1,295 @@
+/// @file fixed_dispatch.h
+/// @brief Contains a runtime dispatch layer that compiles several instruction-set variants of the batch entry points into one binary and resolves once at startup, through CPUID, into function-pointer tables.
+/// @author github.com/SirJonthe
+/// @date 2025
+/// @copyright Public domain.
+/// @license CC0 1.0
+
+#ifndef CC0_FIXED_DISPATCH_H_INCLUDED__
+#define CC0_FIXED_DISPATCH_H_INCLUDED__
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#include "fixed.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+	#include <cpuid.h>
+	#define CC0_FIXED_DISPATCH_TARGETS
+	#if defined(__clang__)
+		// Clang's vectorizer versions aliased loops at any optimization level, so the target attribute alone is enough.
+		#define CC0_FIXED_TARGET_SSE2   __attribute__((target("sse2")))
+		#define CC0_FIXED_TARGET_AVX2   __attribute__((target("avx2")))
+		#define CC0_FIXED_TARGET_AVX512 __attribute__((target("avx512f,avx512bw,avx512dq")))
+	#else
+		// GCC's default cost model at -O2 refuses the runtime alias checks these loops need, so the variants opt into full vectorization themselves.
+		#define CC0_FIXED_TARGET_SSE2   __attribute__((target("sse2"),optimize("O3")))
+		#define CC0_FIXED_TARGET_AVX2   __attribute__((target("avx2"),optimize("O3")))
+		#define CC0_FIXED_TARGET_AVX512 __attribute__((target("avx512f,avx512bw,avx512dq"),optimize("O3")))
+	#endif
+#endif
+
+namespace cc0
+{
+	/// @brief A runtime dispatch layer over the batch entry points. One binary carries a scalar, an SSE2, an AVX2, and an AVX-512 variant of each kernel; the first call resolves the best variant the running machine supports, through CPUID, into a per-type function-pointer table, and every call after that is a single indirect call. The FIXED_FORCE_ISA environment variable ("scalar", "sse2", "avx2", "avx512") caps the selection for benchmarking, clamped to what the machine actually supports.
+	/// @note The variants are the generic loops from the batch headers recompiled per instruction set through function target attributes, so each level gets the compiler's full vectorization for that level from a single translation unit. On compilers or architectures without target attribute support only the scalar variant exists and resolution is a formality.
+	namespace fixed_dispatch
+	{
+		/// @brief The instruction set levels the dispatcher distinguishes, in ascending order of capability.
+		enum isa_t
+		{
+			ISA_SCALAR, // No vector instructions assumed beyond what the whole binary is built with.
+			ISA_SSE2,   // 128-bit integer vectors.
+			ISA_AVX2,   // 256-bit integer vectors.
+			ISA_AVX512  // 512-bit integer vectors.
+		};
+
+		inline isa_t isa( void );
+
+		/// @brief For internal use only.
+		namespace internal
+		{
+			/// @brief The kernel bodies shared by every variant. The target-attributed wrappers below inline these and vectorize them for their own instruction set.
+			/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+			/// @tparam precision The number of bits dedicated to decimals.
+			template < uint32_t bits, uint32_t precision >
+			struct kernels
+			{
+				typedef typename cc0::fixed_internal::intinfo<bits>::int_t      int_t;
+				typedef typename cc0::fixed_internal::intinfo<bits>::next::int_t wide_t;
+
+				/// @brief Adds two arrays element by element.
+				static inline void add_impl(cc0::fixed<bits,precision> *dst, const cc0::fixed<bits,precision> *a, const cc0::fixed<bits,precision> *b, uint64_t n)
+				{
+					for (uint64_t i = 0; i < n; ++i) {
+						dst[i].value_bits = int_t(a[i].value_bits + b[i].value_bits);
+					}
+				}
+
+				/// @brief Multiplies two arrays element by element through the widened intermediate.
+				static inline void mul_impl(cc0::fixed<bits,precision> *dst, const cc0::fixed<bits,precision> *a, const cc0::fixed<bits,precision> *b, uint64_t n)
+				{
+					for (uint64_t i = 0; i < n; ++i) {
+						dst[i].value_bits = int_t((wide_t(a[i].value_bits) * b[i].value_bits) >> precision);
+					}
+				}
+
+				/// @brief Converts an array of floats into fixed-point numbers.
+				static inline void from_float_impl(cc0::fixed<bits,precision> *dst, const float *src, uint64_t n)
+				{
+					const float scale = float(uint64_t(1) << precision);
+					for (uint64_t i = 0; i < n; ++i) {
+						dst[i].value_bits = int_t(src[i] * scale);
+					}
+				}
+
+				/// @brief Converts an array of fixed-point numbers into floats.
+				static inline void to_float_impl(float *dst, const cc0::fixed<bits,precision> *src, uint64_t n)
+				{
+					const float scale = 1.0f / float(uint64_t(1) << precision);
+					for (uint64_t i = 0; i < n; ++i) {
+						dst[i] = float(src[i].value_bits) * scale;
+					}
+				}
+
+				// The scalar variants, compiled with whatever the whole binary is built with.
+				static void add_scalar(cc0::fixed<bits,precision> *dst, const cc0::fixed<bits,precision> *a, const cc0::fixed<bits,precision> *b, uint64_t n) { add_impl(dst, a, b, n); }
+				static void mul_scalar(cc0::fixed<bits,precision> *dst, const cc0::fixed<bits,precision> *a, const cc0::fixed<bits,precision> *b, uint64_t n) { mul_impl(dst, a, b, n); }
+				static void from_float_scalar(cc0::fixed<bits,precision> *dst, const float *src, uint64_t n) { from_float_impl(dst, src, n); }
+				static void to_float_scalar(float *dst, const cc0::fixed<bits,precision> *src, uint64_t n) { to_float_impl(dst, src, n); }
+
+#if defined(CC0_FIXED_DISPATCH_TARGETS)
+				// The vector variants. Each recompiles the shared body under its own target, so the compiler emits 128-, 256-, and 512-bit code for the same loops.
+				CC0_FIXED_TARGET_SSE2   static void add_sse2(cc0::fixed<bits,precision> *dst, const cc0::fixed<bits,precision> *a, const cc0::fixed<bits,precision> *b, uint64_t n) { add_impl(dst, a, b, n); }
+				CC0_FIXED_TARGET_AVX2   static void add_avx2(cc0::fixed<bits,precision> *dst, const cc0::fixed<bits,precision> *a, const cc0::fixed<bits,precision> *b, uint64_t n) { add_impl(dst, a, b, n); }
+				CC0_FIXED_TARGET_AVX512 static void add_avx512(cc0::fixed<bits,precision> *dst, const cc0::fixed<bits,precision> *a, const cc0::fixed<bits,precision> *b, uint64_t n) { add_impl(dst, a, b, n); }
+				CC0_FIXED_TARGET_SSE2   static void mul_sse2(cc0::fixed<bits,precision> *dst, const cc0::fixed<bits,precision> *a, const cc0::fixed<bits,precision> *b, uint64_t n) { mul_impl(dst, a, b, n); }
+				CC0_FIXED_TARGET_AVX2   static void mul_avx2(cc0::fixed<bits,precision> *dst, const cc0::fixed<bits,precision> *a, const cc0::fixed<bits,precision> *b, uint64_t n) { mul_impl(dst, a, b, n); }
+				CC0_FIXED_TARGET_AVX512 static void mul_avx512(cc0::fixed<bits,precision> *dst, const cc0::fixed<bits,precision> *a, const cc0::fixed<bits,precision> *b, uint64_t n) { mul_impl(dst, a, b, n); }
+				CC0_FIXED_TARGET_SSE2   static void from_float_sse2(cc0::fixed<bits,precision> *dst, const float *src, uint64_t n) { from_float_impl(dst, src, n); }
+				CC0_FIXED_TARGET_AVX2   static void from_float_avx2(cc0::fixed<bits,precision> *dst, const float *src, uint64_t n) { from_float_impl(dst, src, n); }
+				CC0_FIXED_TARGET_AVX512 static void from_float_avx512(cc0::fixed<bits,precision> *dst, const float *src, uint64_t n) { from_float_impl(dst, src, n); }
+				CC0_FIXED_TARGET_SSE2   static void to_float_sse2(float *dst, const cc0::fixed<bits,precision> *src, uint64_t n) { to_float_impl(dst, src, n); }
+				CC0_FIXED_TARGET_AVX2   static void to_float_avx2(float *dst, const cc0::fixed<bits,precision> *src, uint64_t n) { to_float_impl(dst, src, n); }
+				CC0_FIXED_TARGET_AVX512 static void to_float_avx512(float *dst, const cc0::fixed<bits,precision> *src, uint64_t n) { to_float_impl(dst, src, n); }
+#endif
+			};
+
+#if defined(CC0_FIXED_DISPATCH_TARGETS)
+			/// @brief Reads an extended control register, used to check that the operating system saves the wider register files.
+			/// @param xcr The register index.
+			/// @return The register contents.
+			inline uint64_t read_xcr(uint32_t xcr)
+			{
+				uint32_t lo, hi;
+				__asm__ __volatile__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(xcr));
+				return (uint64_t(hi) << 32) | lo;
+			}
+#endif
+
+			/// @brief Determines the best instruction set level of the running machine, through CPUID.
+			/// @return The best supported level.
+			inline isa_t machine_isa( void )
+			{
+#if defined(CC0_FIXED_DISPATCH_TARGETS)
+				uint32_t eax = 0, ebx = 0, ecx = 0, edx = 0;
+				if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0) {
+					return ISA_SCALAR;
+				}
+				if ((edx & (uint32_t(1) << 26)) == 0) { // SSE2.
+					return ISA_SCALAR;
+				}
+				// AVX and up need OSXSAVE plus the operating system saving the ymm/zmm state.
+				if ((ecx & (uint32_t(1) << 27)) == 0 || (read_xcr(0) & 0x6) != 0x6) {
+					return ISA_SSE2;
+				}
+				if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) == 0 || (ebx & (uint32_t(1) << 5)) == 0) { // AVX2.
+					return ISA_SSE2;
+				}
+				const bool zmm = (read_xcr(0) & 0xe6) == 0xe6;
+				const bool f   = (ebx & (uint32_t(1) << 16)) != 0; // AVX-512 F.
+				const bool dq  = (ebx & (uint32_t(1) << 17)) != 0; // AVX-512 DQ.
+				const bool bw  = (ebx & (uint32_t(1) << 30)) != 0; // AVX-512 BW.
+				if (zmm && f && dq && bw) {
+					return ISA_AVX512;
+				}
+				return ISA_AVX2;
+#else
+				return ISA_SCALAR;
+#endif
+			}
+
+			/// @brief Parses a FIXED_FORCE_ISA override value.
+			/// @param s The override value.
+			/// @param fallback The level to return when the value is absent or not recognized.
+			/// @return The requested level.
+			inline isa_t parse_isa(const char *s, isa_t fallback)
+			{
+				if (s == nullptr)                    { return fallback; }
+				if (std::strcmp(s, "scalar") == 0)   { return ISA_SCALAR; }
+				if (std::strcmp(s, "sse2") == 0)     { return ISA_SSE2; }
+				if (std::strcmp(s, "avx2") == 0)     { return ISA_AVX2; }
+				if (std::strcmp(s, "avx512") == 0)   { return ISA_AVX512; }
+				return fallback;
+			}
+
+			/// @brief The per-type function-pointer table the entry points call through.
+			/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+			/// @tparam precision The number of bits dedicated to decimals.
+			template < uint32_t bits, uint32_t precision >
+			struct table_t
+			{
+				void (*add)(cc0::fixed<bits,precision>*, const cc0::fixed<bits,precision>*, const cc0::fixed<bits,precision>*, uint64_t);        // The element-wise addition kernel.
+				void (*mul)(cc0::fixed<bits,precision>*, const cc0::fixed<bits,precision>*, const cc0::fixed<bits,precision>*, uint64_t);        // The element-wise multiplication kernel.
+				void (*from_float)(cc0::fixed<bits,precision>*, const float*, uint64_t);                                                         // The float-to-fixed conversion kernel.
+				void (*to_float)(float*, const cc0::fixed<bits,precision>*, uint64_t);                                                           // The fixed-to-float conversion kernel.
+			};
+
+			/// @brief Fills a table with the variants of a given instruction set level.
+			/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+			/// @tparam precision The number of bits dedicated to decimals.
+			/// @param level The instruction set level.
+			/// @return The filled table.
+			template < uint32_t bits, uint32_t precision >
+			inline table_t<bits,precision> make_table(isa_t level)
+			{
+				typedef kernels<bits,precision> k;
+				table_t<bits,precision> t;
+#if defined(CC0_FIXED_DISPATCH_TARGETS)
+				switch (level) {
+				case ISA_AVX512: t.add = &k::add_avx512; t.mul = &k::mul_avx512; t.from_float = &k::from_float_avx512; t.to_float = &k::to_float_avx512; break;
+				case ISA_AVX2:   t.add = &k::add_avx2;   t.mul = &k::mul_avx2;   t.from_float = &k::from_float_avx2;   t.to_float = &k::to_float_avx2;   break;
+				case ISA_SSE2:   t.add = &k::add_sse2;   t.mul = &k::mul_sse2;   t.from_float = &k::from_float_sse2;   t.to_float = &k::to_float_sse2;   break;
+				default:         t.add = &k::add_scalar; t.mul = &k::mul_scalar; t.from_float = &k::from_float_scalar; t.to_float = &k::to_float_scalar; break;
+				}
+#else
+				(void)level;
+				t.add = &k::add_scalar; t.mul = &k::mul_scalar; t.from_float = &k::from_float_scalar; t.to_float = &k::to_float_scalar;
+#endif
+				return t;
+			}
+
+			/// @brief Accesses the resolved table for a given base type, resolving it on the first access.
+			/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+			/// @tparam precision The number of bits dedicated to decimals.
+			/// @return The resolved table.
+			template < uint32_t bits, uint32_t precision >
+			inline const table_t<bits,precision> &table( void )
+			{
+				static const table_t<bits,precision> t = make_table<bits,precision>(cc0::fixed_dispatch::isa());
+				return t;
+			}
+		}
+
+		/// @brief The instruction set level the dispatcher resolved to, i.e. the best level the running machine supports, capped by the FIXED_FORCE_ISA environment variable when set. Resolved once on the first call.
+		/// @return The resolved level.
+		inline isa_t isa( void )
+		{
+			static const isa_t machine = internal::machine_isa();
+			static const isa_t forced  = internal::parse_isa(std::getenv("FIXED_FORCE_ISA"), machine);
+			return forced < machine ? forced : machine;
+		}
+
+		/// @brief The name of an instruction set level, for benchmark logs.
+		/// @param level The level.
+		/// @return The name.
+		inline const char *isa_name(isa_t level)
+		{
+			return level == ISA_AVX512 ? "avx512" : (level == ISA_AVX2 ? "avx2" : (level == ISA_SSE2 ? "sse2" : "scalar"));
+		}
+
+		/// @brief Adds two arrays of fixed-point numbers element by element, through the variant resolved for the running machine.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param dst The destination array. May alias a or b.
+		/// @param a The left-hand side array.
+		/// @param b The right-hand side array.
+		/// @param n The number of elements to process.
+		template < uint32_t bits, uint32_t precision >
+		void add(cc0::fixed<bits,precision> *dst, const cc0::fixed<bits,precision> *a, const cc0::fixed<bits,precision> *b, uint64_t n)
+		{
+			internal::table<bits,precision>().add(dst, a, b, n);
+		}
+
+		/// @brief Multiplies two arrays of fixed-point numbers element by element, through the variant resolved for the running machine.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param dst The destination array. May alias a or b.
+		/// @param a The left-hand side array.
+		/// @param b The right-hand side array.
+		/// @param n The number of elements to process.
+		template < uint32_t bits, uint32_t precision >
+		void mul(cc0::fixed<bits,precision> *dst, const cc0::fixed<bits,precision> *a, const cc0::fixed<bits,precision> *b, uint64_t n)
+		{
+			internal::table<bits,precision>().mul(dst, a, b, n);
+		}
+
+		/// @brief Converts a buffer of floats into a buffer of fixed-point numbers, through the variant resolved for the running machine.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param dst The destination buffer. Must hold n elements.
+		/// @param src The source buffer.
+		/// @param n The number of elements to convert.
+		/// @note Values outside the representable range, infinities, and NaN convert to unspecified results, exactly as a scalar cast would.
+		template < uint32_t bits, uint32_t precision >
+		void from_float(cc0::fixed<bits,precision> *dst, const float *src, uint64_t n)
+		{
+			internal::table<bits,precision>().from_float(dst, src, n);
+		}
+
+		/// @brief Converts a buffer of fixed-point numbers into a buffer of floats, through the variant resolved for the running machine.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param dst The destination buffer. Must hold n elements.
+		/// @param src The source buffer.
+		/// @param n The number of elements to convert.
+		template < uint32_t bits, uint32_t precision >
+		void to_float(float *dst, const cc0::fixed<bits,precision> *src, uint64_t n)
+		{
+			internal::table<bits,precision>().to_float(dst, src, n);
+		}
+	}
+}
+
+#endif
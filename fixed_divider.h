@@ -0,0 +1,101 @@
+/// @file fixed_divider.h
+/// @brief Contains a division engine that precomputes a reciprocal from one divisor so that repeated divisions become a multiply and a shift.
+/// @author github.com/SirJonthe
+/// @date 2025
+/// @copyright Public domain.
+/// @license CC0 1.0
+
+#ifndef CC0_FIXED_DIVIDER_H_INCLUDED__
+#define CC0_FIXED_DIVIDER_H_INCLUDED__
+
+#include <cstdint>
+
+#include "fixed.h"
+
+namespace cc0
+{
+	/// @brief A division engine that precomputes a reciprocal (magic multiplier plus shift) from a single divisor so that every subsequent division by that divisor becomes one full-width multiply, one shift, and one correction instead of a hardware divide.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @note Results match operator/ exactly as long as the upscaled dividend fits in the widened type, i.e. under the same conditions where operator/ itself does not overflow.
+	/// @note Constructing a divider from zero behaves like an integer division by zero.
+	template < uint32_t bits, uint32_t precision >
+	class fixed_divider
+	{
+	private:
+		typedef typename cc0::fixed_internal::intinfo<bits>::int_t int_t;
+
+	private:
+		uint64_t m_recip; // The magic reciprocal multiplier.
+		uint64_t m_abs;   // The absolute value of the divisor's bit representation.
+		uint32_t m_shift; // The number of bits to shift the full-width product down by.
+		bool     m_neg;   // Whether the divisor is negative.
+
+	public:
+		/// @brief Precomputes the reciprocal of a divisor.
+		/// @param d The divisor.
+		fixed_divider(cc0::fixed<bits,precision> d) :
+			m_recip(0),
+			m_abs(d.value_bits < 0 ? uint64_t(-int64_t(d.value_bits)) : uint64_t(d.value_bits)),
+			m_shift((2 * bits - 2 < 62 ? 2 * bits - 2 : 62) + cc0::fixed_internal::bit_width(d.value_bits < 0 ? uint64_t(-int64_t(d.value_bits)) : uint64_t(d.value_bits))),
+			m_neg(d.value_bits < 0)
+		{
+			// The magic multiplier is ceil(2^m_shift / |d|), computed as floor((2^m_shift - 1) / |d|) + 1. The exponent can exceed 63 bits, so the quotient is built by restoring long division, shifting in one dividend bit at a time.
+			uint64_t rem = 0;
+			for (uint32_t i = 0; i < m_shift; ++i) {
+				rem = (rem << 1) | 1;
+				m_recip <<= 1;
+				if (rem >= m_abs) {
+					rem -= m_abs;
+					m_recip |= 1;
+				}
+			}
+			++m_recip;
+		}
+
+		/// @brief The copy constructor.
+		/// @param NA The instance to copy.
+		fixed_divider(const fixed_divider&) = default;
+
+		/// @brief The copy operator.
+		/// @param NA The instance to copy.
+		/// @return The result.
+		fixed_divider &operator=(const fixed_divider&) = default;
+
+		/// @brief Divides a fixed-point number by the precomputed divisor.
+		/// @param x The dividend.
+		/// @return The quotient, identical to x / d.
+		cc0::fixed<bits,precision> operator()(cc0::fixed<bits,precision> x) const
+		{
+			const uint64_t ax = x.value_bits < 0 ? uint64_t(-int64_t(x.value_bits)) : uint64_t(x.value_bits);
+			const uint64_t n  = ax << precision;
+			uint64_t hi, lo;
+			cc0::fixed_internal::umul128(n, m_recip, hi, lo);
+			uint64_t q = m_shift < 64 ? ((lo >> m_shift) | (hi << (64 - m_shift))) : (hi >> (m_shift - 64));
+			// The rounded-up magic multiplier can overshoot the true quotient by a small bounded amount.
+			while (q * m_abs > n) {
+				--q;
+			}
+			cc0::fixed<bits,precision> out;
+			out.value_bits = int_t((x.value_bits < 0) != m_neg ? -int64_t(q) : int64_t(q));
+			return out;
+		}
+	};
+
+	/// @brief Divides an array of fixed-point numbers by a single precomputed divisor.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @param dst The destination array. May alias src.
+	/// @param src The source array.
+	/// @param n The number of elements to process.
+	/// @param div The precomputed divider.
+	template < uint32_t bits, uint32_t precision >
+	void divide(cc0::fixed<bits,precision> *dst, const cc0::fixed<bits,precision> *src, uint64_t n, const fixed_divider<bits,precision> &div)
+	{
+		for (uint64_t i = 0; i < n; ++i) {
+			dst[i] = div(src[i]);
+		}
+	}
+}
+
+#endif
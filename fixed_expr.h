@@ -0,0 +1,218 @@
+/// @file fixed_expr.h
+/// @brief Contains an opt-in expression layer where compound arithmetic evaluates in the widened intermediate domain and pays a single downscaling shift on assignment, instead of one shift and one rounding loss per operator.
+/// @author github.com/SirJonthe
+/// @date 2025
+/// @copyright Public domain.
+/// @license CC0 1.0
+
+#ifndef CC0_FIXED_EXPR_H_INCLUDED__
+#define CC0_FIXED_EXPR_H_INCLUDED__
+
+#include <cstdint>
+
+#include "fixed.h"
+
+namespace cc0
+{
+	/// @brief An opt-in expression layer over fixed-point numbers. Wrapping the first operand of a compound statement in expr keeps the whole computation in the widened intermediate, with the number of fractional bits tracked in the type, and narrows once on assignment, e.g. fixed<32,16> r = expr<32,16>(b) + expr<32,16>(a) * b - a + 10. Everything resolves at compile time; the emitted code is the widened arithmetic and one final shift, with no runtime dispatch.
+	namespace fixed_expr
+	{
+		/// @brief A value in the widened intermediate domain, carrying its number of fractional bits in the type. Sums and differences align their operands to the larger scale; products normalize their operands to the base precision and yield twice that scale, so the low product bits survive subsequent additions until the final narrowing.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @tparam scale The number of fractional bits of the held value. Either precision or twice precision.
+		/// @note For 64-bit base types the widened intermediate aliases the base type, so the extra product bits do not exist and large values may silently truncate just like the operators.
+		template < uint32_t bits, uint32_t precision, uint32_t scale = precision >
+		class expr
+		{
+		private:
+			typedef typename cc0::fixed_internal::intinfo<bits>::int_t        int_t;
+			typedef typename cc0::fixed_internal::intinfo<bits>::next::int_t  wide_t;
+			typedef typename cc0::fixed_internal::intinfo<bits>::next::uint_t uwide_t;
+
+		public:
+			wide_t v; // The value in the widened domain, with scale fractional bits.
+
+			/// @brief The default constructor. Does nothing, and does not initialize the instance.
+			expr( void ) = default;
+
+			/// @brief Adopts a widened value verbatim. For internal use by the operators.
+			/// @param w The widened value at scale fractional bits.
+			constexpr explicit expr(wide_t w) : v(w) {}
+
+			/// @brief Lifts a fixed-point number into the widened domain.
+			/// @param f The number to lift.
+			constexpr expr(cc0::fixed<bits,precision> f) : v(wide_t(uwide_t(wide_t(f.value_bits)) << (scale - precision))) {}
+
+			/// @brief Lifts an integer into the widened domain.
+			/// @param n The number to lift.
+			constexpr expr(int_t n) : v(wide_t(uwide_t(wide_t(n)) << scale)) {}
+
+			/// @brief Narrows the expression back to a fixed-point number with a single downscaling shift, truncating toward negative infinity like the operators do.
+			constexpr operator cc0::fixed<bits,precision>( void ) const { return cc0::fixed<bits,precision>::from_bits(int_t(v >> (scale - precision))); }
+		};
+
+		/// @brief For internal use only.
+		namespace internal
+		{
+			/// @brief Aligns an expression value to a target scale by shifting it up.
+			/// @tparam S The target scale. Must not be smaller than the expression's scale.
+			/// @tparam bits The total number of bits for the base data type.
+			/// @tparam precision The number of bits dedicated to decimals.
+			/// @tparam scale The number of fractional bits of the expression.
+			/// @param e The expression.
+			/// @return The value at the target scale.
+			template < uint32_t S, uint32_t bits, uint32_t precision, uint32_t scale >
+			constexpr typename cc0::fixed_internal::intinfo<bits>::next::int_t aligned(expr<bits,precision,scale> e)
+			{
+				return typename cc0::fixed_internal::intinfo<bits>::next::int_t(typename cc0::fixed_internal::intinfo<bits>::next::uint_t(e.v) << (S - scale));
+			}
+
+			/// @brief Normalizes an expression value down to the base precision for use as a product operand.
+			/// @tparam bits The total number of bits for the base data type.
+			/// @tparam precision The number of bits dedicated to decimals.
+			/// @tparam scale The number of fractional bits of the expression.
+			/// @param e The expression.
+			/// @return The value at the base precision.
+			template < uint32_t bits, uint32_t precision, uint32_t scale >
+			constexpr typename cc0::fixed_internal::intinfo<bits>::next::int_t normalized(expr<bits,precision,scale> e)
+			{
+				return e.v >> (scale - precision);
+			}
+		}
+
+		/// @brief Addition in the widened domain, aligning both operands to the larger scale.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @tparam s1 The scale of the left-hand side operand.
+		/// @tparam s2 The scale of the right-hand side operand.
+		/// @param l The left-hand side operand.
+		/// @param r The right-hand side operand.
+		/// @return The result.
+		template < uint32_t bits, uint32_t precision, uint32_t s1, uint32_t s2 >
+		constexpr expr<bits,precision,(s1 > s2 ? s1 : s2)> operator+(expr<bits,precision,s1> l, expr<bits,precision,s2> r)
+		{
+			return expr<bits,precision,(s1 > s2 ? s1 : s2)>(typename cc0::fixed_internal::intinfo<bits>::next::int_t(internal::aligned<(s1 > s2 ? s1 : s2)>(l) + internal::aligned<(s1 > s2 ? s1 : s2)>(r)));
+		}
+
+		/// @brief Subtraction in the widened domain, aligning both operands to the larger scale.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @tparam s1 The scale of the left-hand side operand.
+		/// @tparam s2 The scale of the right-hand side operand.
+		/// @param l The left-hand side operand.
+		/// @param r The right-hand side operand.
+		/// @return The result.
+		template < uint32_t bits, uint32_t precision, uint32_t s1, uint32_t s2 >
+		constexpr expr<bits,precision,(s1 > s2 ? s1 : s2)> operator-(expr<bits,precision,s1> l, expr<bits,precision,s2> r)
+		{
+			return expr<bits,precision,(s1 > s2 ? s1 : s2)>(typename cc0::fixed_internal::intinfo<bits>::next::int_t(internal::aligned<(s1 > s2 ? s1 : s2)>(l) - internal::aligned<(s1 > s2 ? s1 : s2)>(r)));
+		}
+
+		/// @brief Multiplication in the widened domain. The operands are first normalized to the base precision, so the product carries twice the base precision and its low bits survive until the final narrowing.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @tparam s1 The scale of the left-hand side operand.
+		/// @tparam s2 The scale of the right-hand side operand.
+		/// @param l The left-hand side operand.
+		/// @param r The right-hand side operand.
+		/// @return The result.
+		template < uint32_t bits, uint32_t precision, uint32_t s1, uint32_t s2 >
+		constexpr expr<bits,precision,precision * 2> operator*(expr<bits,precision,s1> l, expr<bits,precision,s2> r)
+		{
+			return expr<bits,precision,precision * 2>(typename cc0::fixed_internal::intinfo<bits>::next::int_t(internal::normalized(l) * internal::normalized(r)));
+		}
+
+		/// @brief Addition with a plain right-hand side, lifted into the expression.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @tparam s1 The scale of the left-hand side operand.
+		/// @param l The left-hand side operand.
+		/// @param r The right-hand side operand.
+		/// @return The result.
+		template < uint32_t bits, uint32_t precision, uint32_t s1 >
+		constexpr expr<bits,precision,s1> operator+(expr<bits,precision,s1> l, cc0::fixed<bits,precision> r) { return l + expr<bits,precision>(r); }
+
+		/// @brief Addition with a plain left-hand side, lifted into the expression.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @tparam s2 The scale of the right-hand side operand.
+		/// @param l The left-hand side operand.
+		/// @param r The right-hand side operand.
+		/// @return The result.
+		template < uint32_t bits, uint32_t precision, uint32_t s2 >
+		constexpr expr<bits,precision,s2> operator+(cc0::fixed<bits,precision> l, expr<bits,precision,s2> r) { return expr<bits,precision>(l) + r; }
+
+		/// @brief Addition with an integer right-hand side, lifted into the expression.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @tparam s1 The scale of the left-hand side operand.
+		/// @param l The left-hand side operand.
+		/// @param r The right-hand side operand.
+		/// @return The result.
+		template < uint32_t bits, uint32_t precision, uint32_t s1 >
+		constexpr expr<bits,precision,s1> operator+(expr<bits,precision,s1> l, typename cc0::fixed_internal::intinfo<bits>::int_t r) { return l + expr<bits,precision>(r); }
+
+		/// @brief Subtraction with a plain right-hand side, lifted into the expression.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @tparam s1 The scale of the left-hand side operand.
+		/// @param l The left-hand side operand.
+		/// @param r The right-hand side operand.
+		/// @return The result.
+		template < uint32_t bits, uint32_t precision, uint32_t s1 >
+		constexpr expr<bits,precision,s1> operator-(expr<bits,precision,s1> l, cc0::fixed<bits,precision> r) { return l - expr<bits,precision>(r); }
+
+		/// @brief Subtraction with a plain left-hand side, lifted into the expression.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @tparam s2 The scale of the right-hand side operand.
+		/// @param l The left-hand side operand.
+		/// @param r The right-hand side operand.
+		/// @return The result.
+		template < uint32_t bits, uint32_t precision, uint32_t s2 >
+		constexpr expr<bits,precision,s2> operator-(cc0::fixed<bits,precision> l, expr<bits,precision,s2> r) { return expr<bits,precision>(l) - r; }
+
+		/// @brief Subtraction with an integer right-hand side, lifted into the expression.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @tparam s1 The scale of the left-hand side operand.
+		/// @param l The left-hand side operand.
+		/// @param r The right-hand side operand.
+		/// @return The result.
+		template < uint32_t bits, uint32_t precision, uint32_t s1 >
+		constexpr expr<bits,precision,s1> operator-(expr<bits,precision,s1> l, typename cc0::fixed_internal::intinfo<bits>::int_t r) { return l - expr<bits,precision>(r); }
+
+		/// @brief Multiplication with a plain right-hand side, lifted into the expression.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @tparam s1 The scale of the left-hand side operand.
+		/// @param l The left-hand side operand.
+		/// @param r The right-hand side operand.
+		/// @return The result.
+		template < uint32_t bits, uint32_t precision, uint32_t s1 >
+		constexpr expr<bits,precision,precision * 2> operator*(expr<bits,precision,s1> l, cc0::fixed<bits,precision> r) { return l * expr<bits,precision>(r); }
+
+		/// @brief Multiplication with a plain left-hand side, lifted into the expression.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @tparam s2 The scale of the right-hand side operand.
+		/// @param l The left-hand side operand.
+		/// @param r The right-hand side operand.
+		/// @return The result.
+		template < uint32_t bits, uint32_t precision, uint32_t s2 >
+		constexpr expr<bits,precision,precision * 2> operator*(cc0::fixed<bits,precision> l, expr<bits,precision,s2> r) { return expr<bits,precision>(l) * r; }
+
+		/// @brief Multiplication with an integer right-hand side, lifted into the expression.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @tparam s1 The scale of the left-hand side operand.
+		/// @param l The left-hand side operand.
+		/// @param r The right-hand side operand.
+		/// @return The result.
+		template < uint32_t bits, uint32_t precision, uint32_t s1 >
+		constexpr expr<bits,precision,precision * 2> operator*(expr<bits,precision,s1> l, typename cc0::fixed_internal::intinfo<bits>::int_t r) { return l * expr<bits,precision>(r); }
+	}
+}
+
+#endif
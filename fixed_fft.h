@@ -0,0 +1,130 @@
+/// @file fixed_fft.h
+/// @brief Contains an in-place fast Fourier transform over arrays of complex fixed-point numbers, with per-stage scaling to keep the butterflies inside the base type and twiddle factors generated by the library's own CORDIC so no floating point is involved anywhere.
+/// @author github.com/SirJonthe
+/// @date 2025
+/// @copyright Public domain.
+/// @license CC0 1.0
+
+#ifndef CC0_FIXED_FFT_H_INCLUDED__
+#define CC0_FIXED_FFT_H_INCLUDED__
+
+#include <cstdint>
+
+#include "fixed.h"
+#include "fixed_math.h"
+#include "fixed_complex.h"
+
+namespace cc0
+{
+	/// @brief An in-place iterative radix-2 fast Fourier transform over interleaved complex fixed-point arrays. Every butterfly shifts its outputs right by one, so each stage divides the data by two and no stage can overflow the base type; across all stages the forward transform therefore returns the spectrum divided by the transform size.
+	namespace fixed_fft
+	{
+		/// @brief For internal use only.
+		namespace internal
+		{
+			/// @brief Reorders an array into bit-reversed index order, the input order the iterative butterflies need.
+			/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+			/// @tparam precision The number of bits dedicated to decimals.
+			/// @param x The array to reorder.
+			/// @param log2n The base-2 logarithm of the transform size.
+			template < uint32_t bits, uint32_t precision >
+			void bit_reverse(cc0::fixed_complex<bits,precision> *x, uint32_t log2n)
+			{
+				const uint32_t n = uint32_t(1) << log2n;
+				for (uint32_t i = 0, j = 0; i < n; ++i) {
+					if (i < j) {
+						const cc0::fixed_complex<bits,precision> t = x[i];
+						x[i] = x[j];
+						x[j] = t;
+					}
+					uint32_t bit = n >> 1;
+					for (; j & bit; bit >>= 1) { j ^= bit; }
+					j |= bit;
+				}
+			}
+
+			/// @brief Runs the butterfly stages over a bit-reversed array.
+			/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+			/// @tparam precision The number of bits dedicated to decimals.
+			/// @param x The array, already in bit-reversed order.
+			/// @param w The twiddle table with 2^(log2n - 1) entries.
+			/// @param log2n The base-2 logarithm of the transform size.
+			/// @param conjugate Whether to conjugate the twiddles, i.e. run the inverse transform.
+			template < uint32_t bits, uint32_t precision >
+			void stages(cc0::fixed_complex<bits,precision> *x, const cc0::fixed_complex<bits,precision> *w, uint32_t log2n, bool conjugate)
+			{
+				typedef typename cc0::fixed_internal::intinfo<bits>::int_t int_t;
+				const uint32_t n = uint32_t(1) << log2n;
+				for (uint32_t s = 1; s <= log2n; ++s) {
+					const uint32_t m    = uint32_t(1) << s;
+					const uint32_t half = m >> 1;
+					const uint32_t step = n >> s; // The twiddle index stride at this stage.
+					for (uint32_t k = 0; k < n; k += m) {
+						for (uint32_t j = 0; j < half; ++j) {
+							cc0::fixed_complex<bits,precision> tw = w[j * step];
+							if (conjugate) { tw = tw.conj(); }
+							const cc0::fixed_complex<bits,precision> t = tw * x[k + j + half];
+							const cc0::fixed_complex<bits,precision> u = x[k + j];
+							x[k + j].re.value_bits          = int_t((u.re.value_bits + t.re.value_bits) >> 1);
+							x[k + j].im.value_bits          = int_t((u.im.value_bits + t.im.value_bits) >> 1);
+							x[k + j + half].re.value_bits   = int_t((u.re.value_bits - t.re.value_bits) >> 1);
+							x[k + j + half].im.value_bits   = int_t((u.im.value_bits - t.im.value_bits) >> 1);
+						}
+					}
+				}
+			}
+		}
+
+		/// @brief Fills a twiddle table with the forward factors e^(-2 pi i k / n) for k = 0 through n/2 - 1, computed with the library's CORDIC so runs are bit-reproducible across machines. The inverse transform conjugates the same table on the fly.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param w The table to fill. Must hold 2^(log2n - 1) entries.
+		/// @param log2n The base-2 logarithm of the transform size. Must be between 1 and 20.
+		template < uint32_t bits, uint32_t precision >
+		void make_twiddles(cc0::fixed_complex<bits,precision> *w, uint32_t log2n)
+		{
+			typedef typename cc0::fixed_internal::intinfo<bits>::int_t int_t;
+			const uint32_t half = uint32_t(1) << (log2n - 1);
+			for (uint32_t k = 0; k < half; ++k) {
+				const uint64_t t = uint64_t(k) << (64 - log2n); // The angle as a fraction of a full turn; the power-of-two size makes this exact.
+				const uint32_t q = uint32_t(t >> 62);
+				uint64_t hi, lo;
+				cc0::fixed_internal::umul128(t << 2, uint64_t(cc0::fixed_internal::PI_2_Q62), hi, lo);
+				int64_t c, s;
+				cc0::fixed_internal::cordic_rotate(int64_t(hi), c, s);
+				const int64_t cos_q62 = q == 0 ? c : (q == 1 ? -s : (q == 2 ? -c : s));
+				const int64_t sin_q62 = q == 0 ? s : (q == 1 ? c : (q == 2 ? -s : -c));
+				w[k].re.value_bits = int_t(cc0::fixed_internal::rescale_q(cos_q62, 62, precision));
+				w[k].im.value_bits = int_t(cc0::fixed_internal::rescale_q(-sin_q62, 62, precision));
+			}
+		}
+
+		/// @brief Transforms an array in place into its spectrum divided by the transform size, i.e. DFT(x) / n from the per-stage scaling.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param x The array to transform. Must hold 2^log2n elements.
+		/// @param w The twiddle table filled by make_twiddles for the same log2n.
+		/// @param log2n The base-2 logarithm of the transform size. Must be between 1 and 20.
+		template < uint32_t bits, uint32_t precision >
+		void forward(cc0::fixed_complex<bits,precision> *x, const cc0::fixed_complex<bits,precision> *w, uint32_t log2n)
+		{
+			internal::bit_reverse(x, log2n);
+			internal::stages(x, w, log2n, false);
+		}
+
+		/// @brief Transforms a spectrum in place back into its signal divided by the transform size. A forward plus inverse round trip therefore returns the original signal divided by the transform size, which block-convolution pipelines fold into their output gain.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param x The array to transform. Must hold 2^log2n elements.
+		/// @param w The twiddle table filled by make_twiddles for the same log2n.
+		/// @param log2n The base-2 logarithm of the transform size. Must be between 1 and 20.
+		template < uint32_t bits, uint32_t precision >
+		void inverse(cc0::fixed_complex<bits,precision> *x, const cc0::fixed_complex<bits,precision> *w, uint32_t log2n)
+		{
+			internal::bit_reverse(x, log2n);
+			internal::stages(x, w, log2n, true);
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,166 @@
+/// @file fixed_fmt.h
+/// @brief Contains integer-only string parsing and formatting for fixed-point numbers, with no floating-point arithmetic and no allocation anywhere.
+/// @author github.com/SirJonthe
+/// @date 2025
+/// @copyright Public domain.
+/// @license CC0 1.0
+
+#ifndef CC0_FIXED_FMT_H_INCLUDED__
+#define CC0_FIXED_FMT_H_INCLUDED__
+
+#include <cstdint>
+
+#include "fixed.h"
+
+namespace cc0
+{
+	/// @brief For internal use only.
+	namespace fixed_internal
+	{
+		/// @brief Divides a 128-bit dividend represented as two 64-bit words by a 64-bit divisor.
+		/// @param hi The high 64 bits of the dividend.
+		/// @param lo The low 64 bits of the dividend.
+		/// @param d The divisor.
+		/// @return The quotient. Must fit in 64 bits.
+		inline uint64_t udiv128(uint64_t hi, uint64_t lo, uint64_t d)
+		{
+#if defined(__SIZEOF_INT128__)
+			typedef unsigned __int128 u128_t;
+			return uint64_t(((u128_t(hi) << 64) | lo) / d);
+#else
+			uint64_t q = 0;
+			uint64_t rem = 0;
+			for (int32_t i = 127; i >= 0; --i) {
+				// The remainder shift can carry out of 64 bits when the divisor has its top bit set, in which case the shifted remainder is certainly larger than the divisor.
+				const uint64_t carry = rem >> 63;
+				rem = (rem << 1) | ((i >= 64 ? (hi >> (i - 64)) : (lo >> i)) & 1);
+				q <<= 1;
+				if (carry != 0 || rem >= d) {
+					rem -= d;
+					q |= 1;
+				}
+			}
+			return q;
+#endif
+		}
+
+		/// @brief Scales a parsed decimal fraction into fractional bits, i.e. computes frac * 2^precision / 10^digits rounded to nearest with integer arithmetic only. Rounding rather than flooring means a fraction truncated to 19 digits still lands on the exact bit pattern, since 19 digits resolve finer than any supported precision.
+		/// @param frac The decimal fraction digits read as an integer.
+		/// @param digits The number of decimal digits. Must be between 1 and 19.
+		/// @param precision The number of bits dedicated to decimals.
+		/// @return The fractional bits.
+		inline uint64_t frac_to_bits(uint64_t frac, uint32_t digits, uint32_t precision)
+		{
+			if (frac == 0) { return 0; }
+			const uint64_t half = POW10[digits] / 2;
+			// The common case fits the upscaled fraction in 64 bits and pays one shift, one add, and one divide.
+			if (bit_width(frac) + precision < 64) {
+				return ((frac << precision) + half) / POW10[digits];
+			}
+			uint64_t hi, lo;
+			hi = precision > 0 ? frac >> ((64 - precision) & 63) : 0;
+			lo = frac << (precision & 63);
+			lo += half;
+			hi += lo < half ? 1 : 0;
+			return udiv128(hi, lo, POW10[digits]);
+		}
+	}
+
+	/// @brief Parses a decimal string such as "-123.456" into a fixed-point number using integer arithmetic only. Both the integer and the fractional part are optional, but at least one digit must be present, and the decimal point is only consumed when a fraction digit follows it.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @param first The first character of the string.
+	/// @param last One past the last character of the string.
+	/// @param out Returns the parsed number. Left untouched when nothing could be parsed.
+	/// @return One past the last character consumed, or first when nothing could be parsed.
+	/// @note The fraction is rounded to the nearest representable value. Fraction digits beyond the first 19 are consumed but do not contribute, which cannot change the result since 19 digits resolve finer than any supported precision. Values that do not fit the format wrap like the arithmetic operators do.
+	template < uint32_t bits, uint32_t precision >
+	const char *from_chars(const char *first, const char *last, cc0::fixed<bits,precision> &out)
+	{
+		typedef typename cc0::fixed_internal::intinfo<bits>::int_t  int_t;
+		typedef typename cc0::fixed_internal::intinfo<bits>::uint_t uint_t;
+
+		const char *p = first;
+		bool neg = false;
+		if (p != last && (*p == '-' || *p == '+')) {
+			neg = (*p == '-');
+			++p;
+		}
+		uint64_t ip = 0;
+		const char *ip_begin = p;
+		while (p != last && *p >= '0' && *p <= '9') {
+			ip = ip * 10 + uint64_t(*p - '0');
+			++p;
+		}
+		uint64_t frac = 0;
+		uint32_t fd = 0;
+		const char *ip_end = p;
+		if (p != last && *p == '.') {
+			++p;
+			while (p != last && *p >= '0' && *p <= '9') {
+				if (fd < 19) {
+					frac = frac * 10 + uint64_t(*p - '0');
+					++fd;
+				}
+				++p;
+			}
+			if (p == ip_end + 1) { p = ip_end; } // A decimal point with no fraction digits is not consumed.
+		}
+		if (p == ip_begin) { return first; }
+		const uint64_t u = (ip << (precision & 63)) + (fd > 0 ? cc0::fixed_internal::frac_to_bits(frac, fd, precision) : 0);
+		out.value_bits = int_t(neg ? uint_t(0) - uint_t(u) : uint_t(u));
+		return p;
+	}
+
+	/// @brief Formats a fixed-point number as a decimal string using integer arithmetic only. Fraction digits are produced with a widened multiply-by-ten per digit, and the expansion terminates exactly since every fixed-point fraction has a finite decimal form.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @param first The first character of the destination buffer.
+	/// @param last One past the last character of the destination buffer.
+	/// @param f The number to format.
+	/// @param max_frac_digits The largest number of fraction digits to emit. The expansion is cut short (truncated, not rounded) when it exceeds this. Defaults to the full exact expansion, which can run to precision digits.
+	/// @return One past the last character written, or null when the buffer is too small. No terminator is written.
+	template < uint32_t bits, uint32_t precision >
+	char *to_chars(char *first, char *last, cc0::fixed<bits,precision> f, uint32_t max_frac_digits = precision)
+	{
+		const int64_t  v    = int64_t(f.value_bits);
+		const uint64_t au   = v < 0 ? uint64_t(-(v + 1)) + 1 : uint64_t(v);
+		const uint64_t mask = precision > 0 ? (uint64_t(1) << (precision & 63)) - 1 : 0;
+		uint64_t ip   = au >> (precision & 63);
+		uint64_t frac = au & mask;
+
+		char *p = first;
+		if (v < 0) {
+			if (p == last) { return nullptr; }
+			*p++ = '-';
+		}
+		char tmp[20];
+		uint32_t id = 0;
+		do {
+			tmp[id++] = char('0' + ip % 10);
+			ip /= 10;
+		} while (ip > 0);
+		if (uint64_t(last - p) < id) { return nullptr; }
+		while (id > 0) { *p++ = tmp[--id]; }
+		if (frac > 0 && max_frac_digits > 0) {
+			if (p == last) { return nullptr; }
+			*p++ = '.';
+			for (uint32_t i = 0; frac > 0 && i < max_frac_digits; ++i) {
+				if (p == last) { return nullptr; }
+				if (bits == 64) {
+					uint64_t hi, lo;
+					cc0::fixed_internal::umul128(frac, 10, hi, lo);
+					*p++ = char('0' + ((precision > 0 ? hi << ((64 - precision) & 63) : 0) | (lo >> (precision & 63))));
+					frac = lo & mask;
+				} else {
+					frac *= 10;
+					*p++ = char('0' + (frac >> (precision & 63)));
+					frac &= mask;
+				}
+			}
+		}
+		return p;
+	}
+}
+
+#endif
@@ -0,0 +1,171 @@
+/// @file fixed_io.h
+/// @brief Contains zero-copy views, endian-explicit load/store helpers, and a small self-describing header format for persisting arrays of fixed-point numbers.
+/// @author github.com/SirJonthe
+/// @date 2025
+/// @copyright Public domain.
+/// @license CC0 1.0
+
+#ifndef CC0_FIXED_IO_H_INCLUDED__
+#define CC0_FIXED_IO_H_INCLUDED__
+
+#include <cstdint>
+
+#include "fixed.h"
+
+namespace cc0
+{
+	/// @brief A non-owning view over a contiguous array of fixed-point numbers, e.g. one mapped straight from disk. Since fixed is trivially copyable with a single integer member, raw storage of the underlying integer type can be viewed in place without parsing.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @note The view assumes the storage uses the native byte order. Use the explicit load/store helpers for foreign byte orders.
+	template < uint32_t bits, uint32_t precision >
+	class fixed_span
+	{
+	private:
+		cc0::fixed<bits,precision> *m_data; // The first element of the viewed array.
+		uint64_t                    m_size; // The number of elements in the viewed array.
+
+	public:
+		/// @brief Constructs an empty view.
+		fixed_span( void ) : m_data(nullptr), m_size(0) {}
+
+		/// @brief Constructs a view over an array of fixed-point numbers.
+		/// @param data The first element of the array.
+		/// @param size The number of elements in the array.
+		fixed_span(cc0::fixed<bits,precision> *data, uint64_t size) : m_data(data), m_size(size) {}
+
+		/// @brief Constructs a view over raw memory, e.g. returned by mmap.
+		/// @param data The raw memory.
+		/// @param byte_count The number of bytes of raw memory. Truncated to whole elements.
+		fixed_span(void *data, uint64_t byte_count) : m_data(reinterpret_cast<cc0::fixed<bits,precision>*>(data)), m_size(byte_count / sizeof(cc0::fixed<bits,precision>)) {}
+
+		/// @brief Returns the first element of the viewed array.
+		/// @return The first element of the viewed array.
+		cc0::fixed<bits,precision> *data( void ) const { return m_data; }
+
+		/// @brief Returns the number of elements in the viewed array.
+		/// @return The number of elements in the viewed array.
+		uint64_t size( void ) const { return m_size; }
+
+		/// @brief Accesses an element in the viewed array.
+		/// @param i The index of the element.
+		/// @return The element.
+		cc0::fixed<bits,precision> &operator[](uint64_t i) const { return m_data[i]; }
+	};
+
+	/// @brief Loads a fixed-point number from little-endian bytes.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @param src The bytes to load from.
+	/// @return The loaded number.
+	template < uint32_t bits, uint32_t precision >
+	cc0::fixed<bits,precision> load_le(const void *src)
+	{
+		typedef typename cc0::fixed_internal::intinfo<bits>::uint_t uint_t;
+		const uint8_t *p = reinterpret_cast<const uint8_t*>(src);
+		uint_t u = 0;
+		for (uint32_t i = 0; i < bits / 8; ++i) {
+			u = uint_t(u | (uint_t(p[i]) << (i * 8)));
+		}
+		cc0::fixed<bits,precision> out;
+		out.value_bits = typename cc0::fixed_internal::intinfo<bits>::int_t(u);
+		return out;
+	}
+
+	/// @brief Loads a fixed-point number from big-endian bytes.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @param src The bytes to load from.
+	/// @return The loaded number.
+	template < uint32_t bits, uint32_t precision >
+	cc0::fixed<bits,precision> load_be(const void *src)
+	{
+		typedef typename cc0::fixed_internal::intinfo<bits>::uint_t uint_t;
+		const uint8_t *p = reinterpret_cast<const uint8_t*>(src);
+		uint_t u = 0;
+		for (uint32_t i = 0; i < bits / 8; ++i) {
+			u = uint_t((u << 8) | p[i]);
+		}
+		cc0::fixed<bits,precision> out;
+		out.value_bits = typename cc0::fixed_internal::intinfo<bits>::int_t(u);
+		return out;
+	}
+
+	/// @brief Stores a fixed-point number as little-endian bytes.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @param dst The bytes to store to.
+	/// @param f The number to store.
+	template < uint32_t bits, uint32_t precision >
+	void store_le(void *dst, cc0::fixed<bits,precision> f)
+	{
+		typedef typename cc0::fixed_internal::intinfo<bits>::uint_t uint_t;
+		uint8_t *p = reinterpret_cast<uint8_t*>(dst);
+		const uint_t u = uint_t(f.value_bits);
+		for (uint32_t i = 0; i < bits / 8; ++i) {
+			p[i] = uint8_t(u >> (i * 8));
+		}
+	}
+
+	/// @brief Stores a fixed-point number as big-endian bytes.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @param dst The bytes to store to.
+	/// @param f The number to store.
+	template < uint32_t bits, uint32_t precision >
+	void store_be(void *dst, cc0::fixed<bits,precision> f)
+	{
+		typedef typename cc0::fixed_internal::intinfo<bits>::uint_t uint_t;
+		uint8_t *p = reinterpret_cast<uint8_t*>(dst);
+		const uint_t u = uint_t(f.value_bits);
+		for (uint32_t i = 0; i < bits / 8; ++i) {
+			p[i] = uint8_t(u >> ((bits / 8 - 1 - i) * 8));
+		}
+	}
+
+	/// @brief The number of bytes occupied by the self-describing array header.
+	static const uint64_t FIXED_IO_HEADER_SIZE = 16;
+
+	/// @brief Writes a self-describing header in front of a persisted array of fixed-point numbers, recording the template parameters and the element count so a reader can validate them before reinterpreting the payload.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @param dst The bytes to write the header to. Must hold at least FIXED_IO_HEADER_SIZE bytes.
+	/// @param count The number of elements in the persisted array.
+	template < uint32_t bits, uint32_t precision >
+	void write_header(void *dst, uint64_t count)
+	{
+		uint8_t *p = reinterpret_cast<uint8_t*>(dst);
+		p[0] = uint8_t('C');
+		p[1] = uint8_t('C');
+		p[2] = uint8_t('0');
+		p[3] = uint8_t('F');
+		p[4] = 1; // Format version.
+		p[5] = uint8_t(bits);
+		p[6] = uint8_t(precision);
+		p[7] = 0; // Reserved.
+		for (uint32_t i = 0; i < 8; ++i) {
+			p[8 + i] = uint8_t(count >> (i * 8));
+		}
+	}
+
+	/// @brief Reads and validates a self-describing array header against the expected template parameters.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @param src The bytes to read the header from. Must hold at least FIXED_IO_HEADER_SIZE bytes.
+	/// @param count Returns the number of elements in the persisted array.
+	/// @return True if the header matches the expected magic, version, bit width, and precision.
+	template < uint32_t bits, uint32_t precision >
+	bool read_header(const void *src, uint64_t &count)
+	{
+		const uint8_t *p = reinterpret_cast<const uint8_t*>(src);
+		if (p[0] != uint8_t('C') || p[1] != uint8_t('C') || p[2] != uint8_t('0') || p[3] != uint8_t('F')) { return false; }
+		if (p[4] != 1 || p[5] != uint8_t(bits) || p[6] != uint8_t(precision)) { return false; }
+		count = 0;
+		for (uint32_t i = 0; i < 8; ++i) {
+			count |= uint64_t(p[8 + i]) << (i * 8);
+		}
+		return true;
+	}
+}
+
+#endif
@@ -0,0 +1,255 @@
+/// @file fixed_la.h
+/// @brief Contains small fixed-point linear algebra types (vectors and matrices) with dot, cross, normalize, and matrix products, all running over contiguous value_bits storage with widened intermediates shared across lanes.
+/// @author github.com/SirJonthe
+/// @date 2025
+/// @copyright Public domain.
+/// @license CC0 1.0
+
+#ifndef CC0_FIXED_LA_H_INCLUDED__
+#define CC0_FIXED_LA_H_INCLUDED__
+
+#include <cstdint>
+
+#include "fixed.h"
+#include "fixed_math.h"
+
+namespace cc0
+{
+	/// @brief Small linear algebra types over fixed-point numbers. Since every type is a contiguous array of value_bits with no padding, whole vectors and matrices can be handed to SIMD or I/O kernels as flat integer arrays.
+	namespace fixed_la
+	{
+		/// @brief A fixed-point vector.
+		/// @tparam n The number of components.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		template < uint32_t n, uint32_t bits, uint32_t precision >
+		class vec
+		{
+		public:
+			cc0::fixed<bits,precision> e[n]; // The components, stored contiguously.
+
+			/// @brief Accesses a component.
+			/// @param i The index of the component.
+			/// @return The component.
+			CC0_FIXED_CONSTEXPR cc0::fixed<bits,precision> &operator[](uint32_t i) { return e[i]; }
+
+			/// @brief Accesses a component.
+			/// @param i The index of the component.
+			/// @return The component.
+			constexpr const cc0::fixed<bits,precision> &operator[](uint32_t i) const { return e[i]; }
+
+			/// @brief Addition.
+			/// @param r The right-hand side operator.
+			/// @return The result.
+			CC0_FIXED_CONSTEXPR vec &operator+=(const vec &r) { for (uint32_t i = 0; i < n; ++i) { e[i] += r.e[i]; } return *this; }
+
+			/// @brief Subtraction.
+			/// @param r The right-hand side operator.
+			/// @return The result.
+			CC0_FIXED_CONSTEXPR vec &operator-=(const vec &r) { for (uint32_t i = 0; i < n; ++i) { e[i] -= r.e[i]; } return *this; }
+
+			/// @brief Scaling.
+			/// @param r The right-hand side operator.
+			/// @return The result.
+			CC0_FIXED_CONSTEXPR vec &operator*=(cc0::fixed<bits,precision> r) { for (uint32_t i = 0; i < n; ++i) { e[i] *= r; } return *this; }
+		};
+
+		/// @brief Addition.
+		/// @tparam n The number of components.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param l The left-hand side operand.
+		/// @param r The right-hand side operand.
+		/// @return The result.
+		template < uint32_t n, uint32_t bits, uint32_t precision >
+		inline CC0_FIXED_CONSTEXPR vec<n,bits,precision> operator+(vec<n,bits,precision> l, const vec<n,bits,precision> &r) { return l += r; }
+
+		/// @brief Subtraction.
+		/// @tparam n The number of components.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param l The left-hand side operand.
+		/// @param r The right-hand side operand.
+		/// @return The result.
+		template < uint32_t n, uint32_t bits, uint32_t precision >
+		inline CC0_FIXED_CONSTEXPR vec<n,bits,precision> operator-(vec<n,bits,precision> l, const vec<n,bits,precision> &r) { return l -= r; }
+
+		/// @brief Scaling.
+		/// @tparam n The number of components.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param l The left-hand side operand.
+		/// @param r The right-hand side operand.
+		/// @return The result.
+		template < uint32_t n, uint32_t bits, uint32_t precision >
+		inline CC0_FIXED_CONSTEXPR vec<n,bits,precision> operator*(vec<n,bits,precision> l, cc0::fixed<bits,precision> r) { return l *= r; }
+
+		/// @brief Computes the dot product of two vectors. The products accumulate in the widened intermediate and pay one downscaling shift total, so no low bits are lost between lanes.
+		/// @tparam n The number of components.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param l The left-hand side operand.
+		/// @param r The right-hand side operand.
+		/// @return The dot product.
+		/// @note For 64-bit base types the widened intermediate aliases the base type, so the products may silently truncate just like operator*.
+		template < uint32_t n, uint32_t bits, uint32_t precision >
+		cc0::fixed<bits,precision> dot(const vec<n,bits,precision> &l, const vec<n,bits,precision> &r)
+		{
+			typedef typename cc0::fixed_internal::intinfo<bits>::next::int_t wide_t;
+			wide_t sum = 0;
+			for (uint32_t i = 0; i < n; ++i) {
+				sum += wide_t(l.e[i].value_bits) * r.e[i].value_bits;
+			}
+			cc0::fixed<bits,precision> out;
+			out.value_bits = typename cc0::fixed_internal::intinfo<bits>::int_t(sum >> precision);
+			return out;
+		}
+
+		/// @brief Computes the cross product of two three-component vectors. Each component is a widened product difference with one downscaling shift.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param l The left-hand side operand.
+		/// @param r The right-hand side operand.
+		/// @return The cross product.
+		template < uint32_t bits, uint32_t precision >
+		vec<3,bits,precision> cross(const vec<3,bits,precision> &l, const vec<3,bits,precision> &r)
+		{
+			typedef typename cc0::fixed_internal::intinfo<bits>::next::int_t wide_t;
+			typedef typename cc0::fixed_internal::intinfo<bits>::int_t      int_t;
+			vec<3,bits,precision> out;
+			out.e[0].value_bits = int_t((wide_t(l.e[1].value_bits) * r.e[2].value_bits - wide_t(l.e[2].value_bits) * r.e[1].value_bits) >> precision);
+			out.e[1].value_bits = int_t((wide_t(l.e[2].value_bits) * r.e[0].value_bits - wide_t(l.e[0].value_bits) * r.e[2].value_bits) >> precision);
+			out.e[2].value_bits = int_t((wide_t(l.e[0].value_bits) * r.e[1].value_bits - wide_t(l.e[1].value_bits) * r.e[0].value_bits) >> precision);
+			return out;
+		}
+
+		/// @brief Computes the length of a vector.
+		/// @tparam n The number of components.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param v The vector.
+		/// @return The length.
+		/// @note The squared length must be representable, so components near the top of the range can overflow the dot product first.
+		template < uint32_t n, uint32_t bits, uint32_t precision >
+		cc0::fixed<bits,precision> length(const vec<n,bits,precision> &v)
+		{
+			return cc0::sqrt(dot(v, v));
+		}
+
+		/// @brief Scales a vector to unit length.
+		/// @tparam n The number of components.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param v The vector. Must not be the zero vector.
+		/// @return The unit-length vector.
+		template < uint32_t n, uint32_t bits, uint32_t precision >
+		vec<n,bits,precision> normalize(const vec<n,bits,precision> &v)
+		{
+			const cc0::fixed<bits,precision> len = length(v);
+			vec<n,bits,precision> out;
+			for (uint32_t i = 0; i < n; ++i) {
+				out.e[i] = v.e[i] / len;
+			}
+			return out;
+		}
+
+		/// @brief A fixed-point matrix in row-major order.
+		/// @tparam rows The number of rows.
+		/// @tparam cols The number of columns.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		template < uint32_t rows, uint32_t cols, uint32_t bits, uint32_t precision >
+		class mat
+		{
+		public:
+			cc0::fixed<bits,precision> e[rows * cols]; // The elements in row-major order, stored contiguously.
+
+			/// @brief Accesses an element.
+			/// @param r The index of the row.
+			/// @param c The index of the column.
+			/// @return The element.
+			CC0_FIXED_CONSTEXPR cc0::fixed<bits,precision> &operator()(uint32_t r, uint32_t c) { return e[r * cols + c]; }
+
+			/// @brief Accesses an element.
+			/// @param r The index of the row.
+			/// @param c The index of the column.
+			/// @return The element.
+			constexpr const cc0::fixed<bits,precision> &operator()(uint32_t r, uint32_t c) const { return e[r * cols + c]; }
+		};
+
+		/// @brief Multiplies a matrix with a vector. Each output component accumulates its products in the widened intermediate and pays one downscaling shift.
+		/// @tparam rows The number of rows of the matrix.
+		/// @tparam cols The number of columns of the matrix, and the number of components of the vector.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param m The matrix.
+		/// @param v The vector.
+		/// @return The transformed vector.
+		template < uint32_t rows, uint32_t cols, uint32_t bits, uint32_t precision >
+		vec<rows,bits,precision> operator*(const mat<rows,cols,bits,precision> &m, const vec<cols,bits,precision> &v)
+		{
+			typedef typename cc0::fixed_internal::intinfo<bits>::next::int_t wide_t;
+			vec<rows,bits,precision> out;
+			for (uint32_t r = 0; r < rows; ++r) {
+				wide_t sum = 0;
+				for (uint32_t c = 0; c < cols; ++c) {
+					sum += wide_t(m.e[r * cols + c].value_bits) * v.e[c].value_bits;
+				}
+				out.e[r].value_bits = typename cc0::fixed_internal::intinfo<bits>::int_t(sum >> precision);
+			}
+			return out;
+		}
+
+		/// @brief Multiplies two matrices. Each output element accumulates its products in the widened intermediate and pays one downscaling shift.
+		/// @tparam rows The number of rows of the left-hand side.
+		/// @tparam inner The number of columns of the left-hand side, and the number of rows of the right-hand side.
+		/// @tparam cols The number of columns of the right-hand side.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param l The left-hand side operand.
+		/// @param r The right-hand side operand.
+		/// @return The product matrix.
+		template < uint32_t rows, uint32_t inner, uint32_t cols, uint32_t bits, uint32_t precision >
+		mat<rows,cols,bits,precision> operator*(const mat<rows,inner,bits,precision> &l, const mat<inner,cols,bits,precision> &r)
+		{
+			typedef typename cc0::fixed_internal::intinfo<bits>::next::int_t wide_t;
+			mat<rows,cols,bits,precision> out;
+			for (uint32_t i = 0; i < rows; ++i) {
+				for (uint32_t j = 0; j < cols; ++j) {
+					wide_t sum = 0;
+					for (uint32_t k = 0; k < inner; ++k) {
+						sum += wide_t(l.e[i * inner + k].value_bits) * r.e[k * cols + j].value_bits;
+					}
+					out.e[i * cols + j].value_bits = typename cc0::fixed_internal::intinfo<bits>::int_t(sum >> precision);
+				}
+			}
+			return out;
+		}
+
+		/// @brief Transforms a struct-of-arrays vertex batch by a square matrix, i.e. computes m * [dst[0][i], ..., dst[n-1][i]]^T for every i. Keeping each component in its own contiguous array lets the inner loop stream at memory bandwidth and hands SIMD-friendly layout to the compiler.
+		/// @tparam n The number of components per vertex, and the dimension of the matrix.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param dst The destination component arrays, one per component. Must not alias src, since every source component contributes to every destination component.
+		/// @param m The matrix.
+		/// @param src The source component arrays, one per component.
+		/// @param count The number of vertices to transform.
+		template < uint32_t n, uint32_t bits, uint32_t precision >
+		void transform(cc0::fixed<bits,precision> *const *dst, const mat<n,n,bits,precision> &m, const cc0::fixed<bits,precision> *const *src, uint64_t count)
+		{
+			typedef typename cc0::fixed_internal::intinfo<bits>::next::int_t wide_t;
+			for (uint32_t r = 0; r < n; ++r) {
+				cc0::fixed<bits,precision> *out = dst[r];
+				for (uint64_t i = 0; i < count; ++i) {
+					wide_t sum = 0;
+					for (uint32_t c = 0; c < n; ++c) {
+						sum += wide_t(m.e[r * n + c].value_bits) * src[c][i].value_bits;
+					}
+					out[i].value_bits = typename cc0::fixed_internal::intinfo<bits>::int_t(sum >> precision);
+				}
+			}
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,118 @@
+/// @file fixed_literals.h
+/// @brief Contains compile-time literal construction for fixed-point numbers, through a rational constant template and user-defined literals parsed digit by digit with integer arithmetic only. Every constant folds to a literal immediate in the emitted code.
+/// @author github.com/SirJonthe
+/// @date 2025
+/// @copyright Public domain.
+/// @license CC0 1.0
+
+#ifndef CC0_FIXED_LITERALS_H_INCLUDED__
+#define CC0_FIXED_LITERALS_H_INCLUDED__
+
+#include <cstdint>
+
+#include "fixed.h"
+
+namespace cc0
+{
+	/// @brief For internal use only.
+	namespace fixed_internal
+	{
+		/// @brief Scales a non-negative rational into a bit representation, i.e. computes num * 2^precision / den rounded to nearest. For internal use by const_bits.
+		/// @param num The numerator.
+		/// @param den The denominator. Must be positive, and must stay below 2^(64 - precision) so the rounding term cannot overflow.
+		/// @param precision The number of bits dedicated to decimals.
+		/// @return The bit representation.
+		constexpr int64_t const_bits_pos(uint64_t num, uint64_t den, uint32_t precision)
+		{
+			return int64_t(((num / den) << (precision & 63)) + (((num % den) << (precision & 63)) + den / 2) / den);
+		}
+
+		/// @brief Scales a rational into a bit representation, i.e. computes num * 2^precision / den rounded to nearest, with the magnitude computed in unsigned arithmetic so no signed intermediate can overflow.
+		/// @param num The numerator.
+		/// @param den The denominator. Must not be zero, and its magnitude must stay below 2^(64 - precision).
+		/// @param precision The number of bits dedicated to decimals.
+		/// @return The bit representation.
+		constexpr int64_t const_bits(int64_t num, int64_t den, uint32_t precision)
+		{
+			return den < 0
+				? const_bits(-num, -den, precision)
+				: (num < 0 ? -const_bits_pos(uint64_t(-num), uint64_t(den), precision) : const_bits_pos(uint64_t(num), uint64_t(den), precision));
+		}
+
+		/// @brief Accumulates the characters of a numeric literal into a numerator and a power-of-ten denominator, entirely at compile time. Digits accumulate into the numerator, the decimal point starts the denominator growing, and digit separators are skipped.
+		/// @tparam num The numerator accumulated so far.
+		/// @tparam den The denominator accumulated so far.
+		/// @tparam dot Whether the decimal point has been seen.
+		/// @tparam cs The remaining characters.
+		template < uint64_t num, uint64_t den, bool dot, char... cs >
+		struct lit_acc
+		{
+			static constexpr uint64_t n = num; // The numerator of the parsed literal.
+			static constexpr uint64_t d = den; // The denominator of the parsed literal.
+		};
+
+		/// @brief Accumulates one character of a numeric literal and recurses on the rest.
+		template < uint64_t num, uint64_t den, bool dot, char c, char... cs >
+		struct lit_acc<num, den, dot, c, cs...> : public lit_acc<
+			(c >= '0' && c <= '9') ? num * 10 + uint64_t(c - '0') : num,
+			(dot && c >= '0' && c <= '9') ? den * 10 : den,
+			dot || c == '.',
+			cs...
+		> {};
+	}
+
+	/// @brief Builds a fixed-point constant from a rational at compile time, i.e. num * 2^precision / den rounded to nearest. Since the whole computation is a constant expression, the constant is a literal immediate in the emitted code with no startup or per-call cost.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @tparam num The numerator.
+	/// @tparam den The denominator. Must not be zero, and its magnitude must stay below 2^(64 - precision).
+	/// @return The constant.
+	template < uint32_t bits, uint32_t precision, int64_t num, int64_t den >
+	constexpr cc0::fixed<bits,precision> fixed_const( void )
+	{
+		return cc0::fixed<bits,precision>::from_bits(typename cc0::fixed_internal::intinfo<bits>::int_t(cc0::fixed_internal::const_bits(num, den, precision)));
+	}
+
+	/// @brief User-defined literals producing fixed-point constants at compile time, e.g. 3.14159_fx32_16. The literal's characters are parsed digit by digit in a constant expression, so no floating point is involved and the constant is a literal immediate in the emitted code.
+	/// @note Only plain decimal literals are supported; hexadecimal and exponent notation are not. A leading minus sign is not part of a literal in C++, so negative constants go through fixed_const or subtraction.
+	namespace fixed_literals
+	{
+		/// @brief Builds a fixed<8,4> constant from a numeric literal at compile time.
+		/// @tparam cs The characters of the literal.
+		/// @return The constant.
+		template < char... cs >
+		constexpr cc0::fixed<8,4> operator"" _fx8_4( void )
+		{
+			return cc0::fixed_const<8,4,int64_t(cc0::fixed_internal::lit_acc<0,1,false,cs...>::n),int64_t(cc0::fixed_internal::lit_acc<0,1,false,cs...>::d)>();
+		}
+
+		/// @brief Builds a fixed<16,8> constant from a numeric literal at compile time.
+		/// @tparam cs The characters of the literal.
+		/// @return The constant.
+		template < char... cs >
+		constexpr cc0::fixed<16,8> operator"" _fx16_8( void )
+		{
+			return cc0::fixed_const<16,8,int64_t(cc0::fixed_internal::lit_acc<0,1,false,cs...>::n),int64_t(cc0::fixed_internal::lit_acc<0,1,false,cs...>::d)>();
+		}
+
+		/// @brief Builds a fixed<32,16> constant from a numeric literal at compile time.
+		/// @tparam cs The characters of the literal.
+		/// @return The constant.
+		template < char... cs >
+		constexpr cc0::fixed<32,16> operator"" _fx32_16( void )
+		{
+			return cc0::fixed_const<32,16,int64_t(cc0::fixed_internal::lit_acc<0,1,false,cs...>::n),int64_t(cc0::fixed_internal::lit_acc<0,1,false,cs...>::d)>();
+		}
+
+		/// @brief Builds a fixed<64,32> constant from a numeric literal at compile time.
+		/// @tparam cs The characters of the literal.
+		/// @return The constant.
+		template < char... cs >
+		constexpr cc0::fixed<64,32> operator"" _fx64_32( void )
+		{
+			return cc0::fixed_const<64,32,int64_t(cc0::fixed_internal::lit_acc<0,1,false,cs...>::n),int64_t(cc0::fixed_internal::lit_acc<0,1,false,cs...>::d)>();
+		}
+	}
+}
+
+#endif
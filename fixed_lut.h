@@ -0,0 +1,114 @@
+/// @file fixed_lut.h
+/// @brief Contains a lookup table with linear interpolation for evaluating user-defined functions over fixed-point numbers, with the index and the interpolation weight extracted from the bit representation by mask and shift.
+/// @author github.com/SirJonthe
+/// @date 2025
+/// @copyright Public domain.
+/// @license CC0 1.0
+
+#ifndef CC0_FIXED_LUT_H_INCLUDED__
+#define CC0_FIXED_LUT_H_INCLUDED__
+
+#include <cstdint>
+
+#include "fixed.h"
+#include "fixed_simd.h"
+
+namespace cc0
+{
+	/// @brief A table of fixed-point samples over the input domain [0, 1) with linear interpolation between neighbouring samples. The sample count is a power of two so the index is the high fractional bits of the input and the interpolation weight is the remaining low bits, i.e. one shift and one mask each, and the interpolation itself is one widened multiply like the multiplication operator's.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @tparam N The number of table segments. Must be a power of two no larger than 2^precision.
+	/// @note Inputs outside [0, 1) wrap around the domain, since the index mask discards the whole bits.
+	template < uint32_t bits, uint32_t precision, uint32_t N >
+	class fixed_lut
+	{
+	public:
+		typedef typename cc0::fixed_internal::intinfo<bits>::int_t  int_t;
+		typedef typename cc0::fixed_internal::intinfo<bits>::uint_t uint_t;
+
+		static constexpr uint32_t LOG2_N    = cc0::fixed_internal::bit_width(N) - 1; // The number of fractional bits consumed by the index.
+		static constexpr uint32_t FRAC_BITS = precision - LOG2_N;                    // The number of fractional bits left over as the interpolation weight.
+
+		cc0::fixed<bits,precision> e[N + 1]; // The samples at i / N for i = 0 through N, stored contiguously. The extra last sample is the right edge of the domain, so the final segment interpolates like every other.
+
+		/// @brief Fills the table by sampling a function at the segment boundaries.
+		/// @tparam fn_t The type of the function. Must accept and return a fixed-point number.
+		/// @param fn The function to sample. Called at i / N for i = 0 through N, the last sample being the right edge of the domain.
+		template < typename fn_t >
+		void fill(fn_t fn)
+		{
+			for (uint32_t i = 0; i <= N; ++i) {
+				e[i] = fn(cc0::fixed<bits,precision>::from_bits(int_t(uint_t(i) << FRAC_BITS)));
+			}
+		}
+
+		/// @brief Evaluates the table at a point, interpolating linearly between the two neighbouring samples.
+		/// @param x The point to evaluate at.
+		/// @return The interpolated value.
+		/// @note For 64-bit base types the widened intermediate aliases the base type, so a large sample delta may silently truncate just like operator*.
+		CC0_FIXED_CONSTEXPR cc0::fixed<bits,precision> operator()(cc0::fixed<bits,precision> x) const
+		{
+			const uint_t u = uint_t(x.value_bits);
+			const uint_t i = (u >> FRAC_BITS) & (N - 1);
+			const uint_t f = u & ((uint_t(1) << FRAC_BITS) - 1);
+			cc0::fixed<bits,precision> out;
+			out.value_bits = int_t(e[i].value_bits + int_t((typename cc0::fixed_internal::intinfo<bits>::next::int_t(e[i + 1].value_bits - e[i].value_bits) * typename cc0::fixed_internal::intinfo<bits>::next::int_t(f)) >> FRAC_BITS));
+			return out;
+		}
+	};
+
+	/// @brief Batch kernels operating on contiguous arrays of fixed-point numbers.
+	namespace fixed_simd
+	{
+		/// @brief Evaluates a lookup table over an array of fixed-point numbers.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @tparam N The number of table segments.
+		/// @param dst The destination array. May alias src.
+		/// @param src The source array.
+		/// @param lut The table to evaluate.
+		/// @param n The number of elements to process.
+		template < uint32_t bits, uint32_t precision, uint32_t N >
+		void lookup(cc0::fixed<bits,precision> *dst, const cc0::fixed<bits,precision> *src, const cc0::fixed_lut<bits,precision,N> &lut, uint64_t n)
+		{
+			for (uint64_t i = 0; i < n; ++i) {
+				dst[i] = lut(src[i]);
+			}
+		}
+
+#if defined(__AVX2__)
+
+		/// @brief Evaluates a lookup table over an array of 32-bit fixed-point numbers, eight lanes at a time with gathered table loads.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @tparam N The number of table segments.
+		/// @param dst The destination array. May alias src.
+		/// @param src The source array.
+		/// @param lut The table to evaluate.
+		/// @param n The number of elements to process.
+		template < uint32_t precision, uint32_t N >
+		void lookup(cc0::fixed<32,precision> *dst, const cc0::fixed<32,precision> *src, const cc0::fixed_lut<32,precision,N> &lut, uint64_t n)
+		{
+			const uint32_t FRAC_BITS = cc0::fixed_lut<32,precision,N>::FRAC_BITS;
+			const int32_t *tbl = &lut.e[0].value_bits;
+			const __m256i idx_mask  = _mm256_set1_epi32(int32_t(N - 1));
+			const __m256i frac_mask = _mm256_set1_epi32(int32_t((uint32_t(1) << FRAC_BITS) - 1));
+			uint64_t i = 0;
+			for (; i + 8 <= n; i += 8) {
+				const __m256i v  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+				const __m256i vi = _mm256_and_si256(_mm256_srli_epi32(v, FRAC_BITS), idx_mask);
+				const __m256i vf = _mm256_and_si256(v, frac_mask);
+				const __m256i va = _mm256_i32gather_epi32(tbl, vi, 4);
+				const __m256i vb = _mm256_i32gather_epi32(tbl + 1, vi, 4);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_add_epi32(va, mul_8lanes<cc0::fixed_lut<32,precision,N>::FRAC_BITS>(_mm256_sub_epi32(vb, va), vf)));
+			}
+			for (; i < n; ++i) {
+				dst[i] = lut(src[i]);
+			}
+		}
+
+#endif
+	}
+}
+
+#endif
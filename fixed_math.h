@@ -0,0 +1,470 @@
+/// @file fixed_math.h
+/// @brief Contains fast transcendental math functions for fixed-point numbers that stay in integer arithmetic end to end.
+/// @author github.com/SirJonthe
+/// @date 2025
+/// @copyright Public domain.
+/// @license CC0 1.0
+
+#ifndef CC0_FIXED_MATH_H_INCLUDED__
+#define CC0_FIXED_MATH_H_INCLUDED__
+
+#include <cstdint>
+
+#include "fixed.h"
+#include "fixed_divider.h"
+
+namespace cc0
+{
+	/// @brief For internal use only.
+	namespace fixed_internal
+	{
+		static const int64_t  PI_Q61      = INT64_C(7244019458077122842); // Pi at 61 bits of precision.
+		static const int64_t  PI_2_Q62    = INT64_C(7244019458077122842); // Pi over two at 62 bits of precision.
+		static const int64_t  INV_2PI_Q63 = INT64_C(1467945251641000613); // The reciprocal of two pi at 63 bits of precision.
+		static const int64_t  CORDIC_K_Q62 = INT64_C(2800459870029452953); // The aggregate CORDIC gain correction, i.e. the product of 1/sqrt(1+2^-2i).
+
+		/// @brief The arctangents of the negative powers of two at 62 bits of precision, i.e. the rotation angles of the individual CORDIC iterations.
+		static const int64_t ATAN_Q62[48] = {
+			INT64_C(3622009729038561421), INT64_C(2138197195906305896), INT64_C(1129764675555192497), INT64_C(573486189672913777),
+			INT64_C(287855953345232184), INT64_C(144068303048368714), INT64_C(72051730834756821), INT64_C(36028064038054492),
+			INT64_C(18014306884351854), INT64_C(9007187801521083), INT64_C(4503598195715549), INT64_C(2251799634728302),
+			INT64_C(1125899884473003), INT64_C(562949950625109), INT64_C(281474976361130), INT64_C(140737488311637),
+			INT64_C(70368744172202), INT64_C(35184372088149), INT64_C(17592186044330), INT64_C(8796093022197),
+			INT64_C(4398046511102), INT64_C(2199023255551), INT64_C(1099511627775), INT64_C(549755813887),
+			INT64_C(274877906943), INT64_C(137438953471), INT64_C(68719476735), INT64_C(34359738367),
+			INT64_C(17179869183), INT64_C(8589934591), INT64_C(4294967295), INT64_C(2147483647),
+			INT64_C(1073741823), INT64_C(536870911), INT64_C(268435455), INT64_C(134217727),
+			INT64_C(67108863), INT64_C(33554431), INT64_C(16777215), INT64_C(8388607),
+			INT64_C(4194303), INT64_C(2097151), INT64_C(1048575), INT64_C(524287),
+			INT64_C(262143), INT64_C(131071), INT64_C(65535), INT64_C(32767)
+		};
+
+		/// @brief Two raised to the negative powers of two at 62 bits of precision, i.e. 2^(2^-i) for i = 1 through 48, used to assemble 2^f for a fractional f one bit at a time.
+		static const int64_t EXP2_Q62[48] = {
+			INT64_C(6521908912666391106), INT64_C(5484249825272419511), INT64_C(5029079263719320435), INT64_C(4815862801830788490),
+			INT64_C(4712668792719003883), INT64_C(4661903986662671289), INT64_C(4636727017470743989), INT64_C(4624189567668517719),
+			INT64_C(4617933561212708775), INT64_C(4614808732577250067), INT64_C(4613247111281068007), INT64_C(4612466498810092973),
+			INT64_C(4612076242109103706), INT64_C(4611881126141011235), INT64_C(4611783571252412753), INT64_C(4611734794581956352),
+			INT64_C(4611710406440186475), INT64_C(4611698212417665818), INT64_C(4611692115418496523), INT64_C(4611689066921934629),
+			INT64_C(4611687542674409370), INT64_C(4611686780550835663), INT64_C(4611686399489096040), INT64_C(4611686208958238036),
+			INT64_C(4611686113692811986), INT64_C(4611686066060099699), INT64_C(4611686042243743740), INT64_C(4611686030335565806),
+			INT64_C(4611686024381476851), INT64_C(4611686021404432376), INT64_C(4611686019915910139), INT64_C(4611686019171649021),
+			INT64_C(4611686018799518462), INT64_C(4611686018613453182), INT64_C(4611686018520420542), INT64_C(4611686018473904222),
+			INT64_C(4611686018450646062), INT64_C(4611686018439016982), INT64_C(4611686018433202442), INT64_C(4611686018430295172),
+			INT64_C(4611686018428841537), INT64_C(4611686018428114720), INT64_C(4611686018427751311), INT64_C(4611686018427569607),
+			INT64_C(4611686018427478755), INT64_C(4611686018427433329), INT64_C(4611686018427410616), INT64_C(4611686018427399259)
+		};
+
+		/// @brief Reciprocal seeds at 62 bits of precision, i.e. 1/m sampled at the midpoints of 16 equal intervals over [1,2), used to start the Newton-Raphson iterations with about 5 good bits.
+		static const int64_t RCP_SEED_Q62[16] = {
+			INT64_C(4471937957262921604), INT64_C(4216398645419326084), INT64_C(3988485205126389539), INT64_C(3783947502299395203),
+			INT64_C(3599364697309180803), INT64_C(3431952385806428208), INT64_C(3279421168659475843), INT64_C(3139871331695242828),
+			INT64_C(3011713318156661488), INT64_C(2893606913523066920), INT64_C(2784414199805215338), INT64_C(2683162774357752962),
+			INT64_C(2589016712099586192), INT64_C(2501253433723329033), INT64_C(2419245124420924802), INT64_C(2342443691899625602)
+		};
+
+		/// @brief Reciprocal square root seeds at 62 bits of precision, i.e. 1/sqrt(m) sampled at the midpoints of 24 equal intervals over [1,4), used to start the Newton-Raphson iterations with about 5 good bits.
+		static const int64_t RSQRT_SEED_Q62[24] = {
+			INT64_C(4473992603802417234), INT64_C(4231973329192512909), INT64_C(4025409573488193887), INT64_C(3846412031790363502),
+			INT64_C(3689348814741910323), INT64_C(3550077552209447800), INT64_C(3425474379033022508), INT64_C(3313133040769224019),
+			INT64_C(3211165968366019329), INT64_C(3118068847956735193), INT64_C(3032626044798951377), INT64_C(2953843072238042667),
+			INT64_C(2880897416587570571), INT64_C(2813102098532154374), INT64_C(2749878247490396573), INT64_C(2690734167475480531),
+			INT64_C(2635249153387078802), INT64_C(2583060834157720281), INT64_C(2533855168981881139), INT64_C(2487358463477921147),
+			INT64_C(2443330940812614059), INT64_C(2401561522098213045), INT64_C(2361863556118410215), INT64_C(2324071300851905377)
+		};
+
+		/// @brief Computes the integer square root of a number.
+		/// @param n The radicand.
+		/// @return The largest integer whose square does not exceed the radicand.
+		inline uint64_t isqrt(uint64_t n)
+		{
+			uint64_t r = 0;
+			uint64_t bit = uint64_t(1) << 62;
+			while (bit > n) { bit >>= 2; }
+			while (bit != 0) {
+				if (n >= r + bit) {
+					n -= r + bit;
+					r = (r >> 1) + bit;
+				} else {
+					r >>= 1;
+				}
+				bit >>= 2;
+			}
+			return r;
+		}
+
+		/// @brief Computes the integer square root of a 128-bit number represented as two 64-bit words.
+		/// @param hi The high 64 bits of the radicand.
+		/// @param lo The low 64 bits of the radicand.
+		/// @return The largest integer whose square does not exceed the radicand.
+		inline uint64_t isqrt128(uint64_t hi, uint64_t lo)
+		{
+			if (hi == 0) {
+				return isqrt(lo);
+			}
+#if defined(__SIZEOF_INT128__)
+			typedef unsigned __int128 u128_t;
+			u128_t n = (u128_t(hi) << 64) | lo;
+			u128_t r = 0;
+			u128_t bit = u128_t(1) << 126;
+			while (bit > n) { bit >>= 2; }
+			while (bit != 0) {
+				if (n >= r + bit) {
+					n -= r + bit;
+					r = (r >> 1) + bit;
+				} else {
+					r >>= 1;
+				}
+				bit >>= 2;
+			}
+			return uint64_t(r);
+#else
+			// Scale the radicand down by an even shift until it fits in 64 bits, then correct the estimated root against the full 128-bit radicand.
+			const uint32_t s = (bit_width(hi) + 1) & ~uint32_t(1);
+			uint64_t r = isqrt(s < 64 ? ((hi << (64 - s)) | (lo >> s)) : hi) << (s / 2);
+			uint64_t phi, plo;
+			for (;;) {
+				umul128(r, r, phi, plo);
+				if (phi > hi || (phi == hi && plo > lo)) { --r; } else { break; }
+			}
+			for (;;) {
+				umul128(r + 1, r + 1, phi, plo);
+				if (phi < hi || (phi == hi && plo <= lo)) { ++r; } else { break; }
+			}
+			return r;
+#endif
+		}
+
+		/// @brief Shifts a 128-bit number represented as two 64-bit words to the right.
+		/// @param hi The high 64 bits.
+		/// @param lo The low 64 bits.
+		/// @param s The number of bits to shift by. Must be less than 64.
+		/// @return The low 64 bits of the shifted number.
+		inline uint64_t shr128(uint64_t hi, uint64_t lo, uint32_t s)
+		{
+			return s > 0 ? ((lo >> s) | (hi << (64 - s))) : lo;
+		}
+
+		/// @brief Converts an internal high-precision value into the bit representation of the target precision.
+		/// @param q The internal value.
+		/// @param from_precision The precision of the internal value.
+		/// @param to_precision The precision of the target representation.
+		/// @return The bit representation at the target precision.
+		inline int64_t rescale_q(int64_t q, uint32_t from_precision, uint32_t to_precision)
+		{
+			return from_precision >= to_precision ? (q >> (from_precision - to_precision)) : int64_t(uint64_t(q) << (to_precision - from_precision));
+		}
+
+		/// @brief Converts a fixed-point bit representation of an angle in radians into a full unsigned turn, i.e. the angle divided by two pi modulo one at 64 bits of precision.
+		/// @param value_bits The bit representation of the angle.
+		/// @param precision The number of bits dedicated to decimals.
+		/// @return The angle as a fraction of a full turn, where wrap-around performs the modulo for free.
+		inline uint64_t radians_to_turn(int64_t value_bits, uint32_t precision)
+		{
+			int64_t  hi;
+			uint64_t lo;
+			imul128(value_bits, INV_2PI_Q63, hi, lo);
+			return shr128(uint64_t(hi), lo, precision > 0 ? precision - 1 : 0) << (precision > 0 ? 0 : 1);
+		}
+
+		/// @brief Rotates a unit vector by an angle using CORDIC iterations.
+		/// @param z The angle at 62 bits of precision. Must be within [0, pi/2].
+		/// @param x Returns the cosine of the angle at 62 bits of precision.
+		/// @param y Returns the sine of the angle at 62 bits of precision.
+		inline void cordic_rotate(int64_t z, int64_t &x, int64_t &y)
+		{
+			x = CORDIC_K_Q62;
+			y = 0;
+			for (uint32_t i = 0; i < 48; ++i) {
+				const int64_t xs = x >> i;
+				const int64_t ys = y >> i;
+				if (z >= 0) {
+					x -= ys;
+					y += xs;
+					z -= ATAN_Q62[i];
+				} else {
+					x += ys;
+					y -= xs;
+					z += ATAN_Q62[i];
+				}
+			}
+		}
+
+		/// @brief Drives a vector toward the positive x axis using CORDIC iterations, accumulating the angle it is rotated by.
+		/// @param x The x component. Must be positive.
+		/// @param y The y component.
+		/// @return The arctangent of y/x at 62 bits of precision.
+		inline int64_t cordic_vector(int64_t x, int64_t y)
+		{
+			int64_t z = 0;
+			for (uint32_t i = 0; i < 48; ++i) {
+				const int64_t xs = x >> i;
+				const int64_t ys = y >> i;
+				if (y >= 0) {
+					x += ys;
+					y -= xs;
+					z += ATAN_Q62[i];
+				} else {
+					x -= ys;
+					y += xs;
+					z -= ATAN_Q62[i];
+				}
+			}
+			return z;
+		}
+	}
+
+	/// @brief Computes the square root of a fixed-point number using integer arithmetic only.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @param x The radicand.
+	/// @return The square root. Zero for negative radicands.
+	template < uint32_t bits, uint32_t precision >
+	cc0::fixed<bits,precision> sqrt(cc0::fixed<bits,precision> x)
+	{
+		typedef typename cc0::fixed_internal::intinfo<bits>::int_t int_t;
+		cc0::fixed<bits,precision> out;
+		if (x.value_bits > 0) {
+			const uint64_t lo = uint64_t(x.value_bits) << precision;
+			const uint64_t hi = precision > 0 ? uint64_t(x.value_bits) >> (64 - precision) : 0;
+			out.value_bits = int_t(cc0::fixed_internal::isqrt128(hi, lo));
+		} else {
+			out.value_bits = 0;
+		}
+		return out;
+	}
+
+	/// @brief Computes an approximate reciprocal using table-seeded Newton-Raphson iterations in the widened integer domain. Each iteration roughly doubles the number of good bits from the seed's 5, so the default two iterations give around 20 and cost four multiplies where full division is unavailable or too slow.
+	/// @tparam iterations The number of Newton-Raphson iterations. Trades precision for speed.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @param x The number.
+	/// @return The approximate reciprocal, rounded to nearest. The highest representable value for zero input; overflow for small inputs wraps like the other operators.
+	template < uint32_t iterations = 2, uint32_t bits, uint32_t precision >
+	cc0::fixed<bits,precision> rcp(cc0::fixed<bits,precision> x)
+	{
+		typedef typename cc0::fixed_internal::intinfo<bits>::int_t  int_t;
+		typedef typename cc0::fixed_internal::intinfo<bits>::uint_t uint_t;
+		cc0::fixed<bits,precision> out;
+		if (x.value_bits == 0) {
+			out.value_bits = int_t((uint_t(1) << (bits - 1)) - 1);
+			return out;
+		}
+		const bool     neg = x.value_bits < 0;
+		const uint64_t v   = neg ? uint64_t(-int64_t(x.value_bits)) : uint64_t(x.value_bits);
+		const uint32_t msb = cc0::fixed_internal::bit_width(v) - 1;
+		const uint64_t m   = msb <= 62 ? v << (62 - msb) : v >> (msb - 62); // The mantissa in [1,2) at 62 bits of precision.
+		uint64_t y = uint64_t(cc0::fixed_internal::RCP_SEED_Q62[(m >> 58) & 15]);
+		for (uint32_t i = 0; i < iterations; ++i) {
+			uint64_t hi, lo;
+			cc0::fixed_internal::umul128(m, y, hi, lo);
+			const uint64_t e = (uint64_t(2) << 62) - ((hi << 2) | (lo >> 62)); // 2 - m*y.
+			cc0::fixed_internal::umul128(y, e, hi, lo);
+			y = (hi << 2) | (lo >> 62); // y*(2 - m*y).
+		}
+		// The reciprocal is y/m scaled by 2^-(msb - precision); line the result up with the target precision.
+		const int64_t shift = int64_t(62 + msb) - int64_t(2 * precision);
+		uint64_t r;
+		if (shift >= 64) {
+			r = 0;
+		} else if (shift > 0) {
+			r = (y + (uint64_t(1) << (shift - 1))) >> shift; // Round to nearest, which also lands exact reciprocals on the dot.
+		} else {
+			r = y << -shift;
+		}
+		out.value_bits = int_t(neg ? -int64_t(r) : int64_t(r));
+		return out;
+	}
+
+	/// @brief Computes an approximate reciprocal square root using table-seeded Newton-Raphson iterations in the widened integer domain. Each iteration roughly doubles the number of good bits from the seed's 5, so the default two iterations give around 20 at four multiplies per iteration where a division and a square root would otherwise be needed.
+	/// @tparam iterations The number of Newton-Raphson iterations. Trades precision for speed.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @param x The number.
+	/// @return The approximate reciprocal square root. Zero for non-positive input; overflow for small inputs wraps like the other operators.
+	template < uint32_t iterations = 2, uint32_t bits, uint32_t precision >
+	cc0::fixed<bits,precision> rsqrt(cc0::fixed<bits,precision> x)
+	{
+		typedef typename cc0::fixed_internal::intinfo<bits>::int_t int_t;
+		cc0::fixed<bits,precision> out;
+		if (x.value_bits <= 0) {
+			out.value_bits = 0;
+			return out;
+		}
+		const uint64_t v   = uint64_t(x.value_bits);
+		const uint32_t msb = cc0::fixed_internal::bit_width(v) - 1;
+		const int64_t  e   = int64_t(msb) - int64_t(precision);
+		const int64_t  k   = e >> 1;                                          // The even part of the exponent, halved. The shift floors for odd negative exponents.
+		const uint64_t m0  = msb <= 62 ? v << (62 - msb) : v >> (msb - 62);   // The mantissa in [1,2) at 62 bits of precision.
+		const uint64_t m   = (e & 1) != 0 ? m0 : m0 >> 1;                     // The mantissa with the odd exponent bit folded in, i.e. in [1,4) at 61 bits of precision.
+		uint64_t y = uint64_t(cc0::fixed_internal::RSQRT_SEED_Q62[(m >> 58) - 8]);
+		for (uint32_t i = 0; i < iterations; ++i) {
+			uint64_t hi, lo;
+			cc0::fixed_internal::umul128(y, y, hi, lo);
+			const uint64_t yy = (hi << 2) | (lo >> 62);
+			cc0::fixed_internal::umul128(m, yy, hi, lo);
+			const uint64_t h = (uint64_t(3) << 61) - ((hi << 2) | (lo >> 62)); // (3 - m*y*y) at 61 bits, which reads as (3 - m*y*y)/2 at 62.
+			cc0::fixed_internal::umul128(y, h, hi, lo);
+			y = (hi << 2) | (lo >> 62); // y*(3 - m*y*y)/2.
+		}
+		// The reciprocal square root is 1/sqrt(m) scaled by 2^-k; line the result up with the target precision.
+		const int64_t shift = int64_t(62) + k - int64_t(precision);
+		if (shift >= 64) {
+			out.value_bits = 0;
+		} else if (shift > 0) {
+			out.value_bits = int_t((y + (uint64_t(1) << (shift - 1))) >> shift); // Round to nearest, which also lands exact roots on the dot.
+		} else {
+			out.value_bits = int_t(y << -shift);
+		}
+		return out;
+	}
+
+	/// @brief Computes the sine of a fixed-point angle in radians using CORDIC iterations.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @param x The angle in radians. Reduced modulo two pi internally.
+	/// @return The sine.
+	template < uint32_t bits, uint32_t precision >
+	cc0::fixed<bits,precision> sin(cc0::fixed<bits,precision> x)
+	{
+		typedef typename cc0::fixed_internal::intinfo<bits>::int_t int_t;
+		const uint64_t t = cc0::fixed_internal::radians_to_turn(int64_t(x.value_bits), precision);
+		const uint32_t quadrant = uint32_t(t >> 62);
+		uint64_t hi, lo;
+		cc0::fixed_internal::umul128(t << 2, uint64_t(cc0::fixed_internal::PI_2_Q62), hi, lo);
+		int64_t c, s;
+		cc0::fixed_internal::cordic_rotate(int64_t(hi), c, s);
+		const int64_t r = quadrant == 0 ? s : (quadrant == 1 ? c : (quadrant == 2 ? -s : -c));
+		cc0::fixed<bits,precision> out;
+		out.value_bits = int_t(cc0::fixed_internal::rescale_q(r, 62, precision));
+		return out;
+	}
+
+	/// @brief Computes the cosine of a fixed-point angle in radians using CORDIC iterations.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @param x The angle in radians. Reduced modulo two pi internally.
+	/// @return The cosine.
+	template < uint32_t bits, uint32_t precision >
+	cc0::fixed<bits,precision> cos(cc0::fixed<bits,precision> x)
+	{
+		typedef typename cc0::fixed_internal::intinfo<bits>::int_t int_t;
+		const uint64_t t = cc0::fixed_internal::radians_to_turn(int64_t(x.value_bits), precision);
+		const uint32_t quadrant = uint32_t(t >> 62);
+		uint64_t hi, lo;
+		cc0::fixed_internal::umul128(t << 2, uint64_t(cc0::fixed_internal::PI_2_Q62), hi, lo);
+		int64_t c, s;
+		cc0::fixed_internal::cordic_rotate(int64_t(hi), c, s);
+		const int64_t r = quadrant == 0 ? c : (quadrant == 1 ? -s : (quadrant == 2 ? -c : s));
+		cc0::fixed<bits,precision> out;
+		out.value_bits = int_t(cc0::fixed_internal::rescale_q(r, 62, precision));
+		return out;
+	}
+
+	/// @brief Raises two to a fixed-point power.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @param x The exponent.
+	/// @return The result. Zero when the result underflows the representable range; overflow wraps like the other operators.
+	template < uint32_t bits, uint32_t precision >
+	cc0::fixed<bits,precision> exp2(cc0::fixed<bits,precision> x)
+	{
+		typedef typename cc0::fixed_internal::intinfo<bits>::int_t int_t;
+		const int64_t  n = int64_t(x.value_bits) >> precision;
+		const uint64_t f = (uint64_t(x.value_bits) - (uint64_t(n) << precision)) << (62 - precision);
+		uint64_t m = uint64_t(1) << 62;
+		for (uint32_t i = 1; i <= 48; ++i) {
+			if ((f >> (62 - i)) & 1) {
+				uint64_t hi, lo;
+				cc0::fixed_internal::umul128(m, uint64_t(cc0::fixed_internal::EXP2_Q62[i - 1]), hi, lo);
+				m = (hi << 2) | (lo >> 62);
+			}
+		}
+		const int64_t shift = 62 - int64_t(precision) - n;
+		cc0::fixed<bits,precision> out;
+		if (shift >= 64) {
+			out.value_bits = 0;
+		} else if (shift >= 0) {
+			out.value_bits = int_t(m >> shift);
+		} else {
+			out.value_bits = int_t(m << -shift);
+		}
+		return out;
+	}
+
+	/// @brief Computes the base-2 logarithm of a fixed-point number using integer arithmetic only.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @param x The number. Must be positive.
+	/// @return The base-2 logarithm. The lowest representable value for non-positive input.
+	template < uint32_t bits, uint32_t precision >
+	cc0::fixed<bits,precision> log2(cc0::fixed<bits,precision> x)
+	{
+		typedef typename cc0::fixed_internal::intinfo<bits>::int_t  int_t;
+		typedef typename cc0::fixed_internal::intinfo<bits>::uint_t uint_t;
+		cc0::fixed<bits,precision> out;
+		if (x.value_bits <= 0) {
+			out.value_bits = int_t(uint_t(1) << (bits - 1));
+			return out;
+		}
+		const uint32_t msb = cc0::fixed_internal::bit_width(uint64_t(x.value_bits)) - 1;
+		const int64_t  n   = int64_t(msb) - int64_t(precision);
+		uint64_t m = msb <= 62 ? (uint64_t(x.value_bits) << (62 - msb)) : (uint64_t(x.value_bits) >> (msb - 62));
+		uint64_t frac = 0;
+		for (uint32_t i = 1; i <= 48; ++i) {
+			uint64_t hi, lo;
+			cc0::fixed_internal::umul128(m, m, hi, lo);
+			m = (hi << 2) | (lo >> 62);
+			frac <<= 1;
+			if (m >= (uint64_t(2) << 62)) {
+				m >>= 1;
+				frac |= 1;
+			}
+		}
+		// The fraction holds 48 bits; line it up with the target precision.
+		const int64_t f = precision <= 48 ? int64_t(frac >> (48 - precision)) : int64_t(frac << (precision - 48));
+		out.value_bits = int_t(int64_t(uint64_t(n) << precision) + f);
+		return out;
+	}
+
+	/// @brief Computes the angle of the vector (x, y) relative to the positive x axis using CORDIC iterations.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @param y The y component of the vector.
+	/// @param x The x component of the vector.
+	/// @return The angle in radians within (-pi, pi]. Zero when both components are zero.
+	template < uint32_t bits, uint32_t precision >
+	cc0::fixed<bits,precision> atan2(cc0::fixed<bits,precision> y, cc0::fixed<bits,precision> x)
+	{
+		typedef typename cc0::fixed_internal::intinfo<bits>::int_t int_t;
+		cc0::fixed<bits,precision> out;
+		int64_t vx = int64_t(x.value_bits);
+		int64_t vy = int64_t(y.value_bits);
+		if (vx == 0 && vy == 0) {
+			out.value_bits = 0;
+			return out;
+		}
+		// Scale both components so the larger one sits just below bit 61, maximizing the precision of the iterations.
+		const uint64_t ax = uint64_t(vx < 0 ? -vx : vx);
+		const uint64_t ay = uint64_t(vy < 0 ? -vy : vy);
+		const uint32_t w  = cc0::fixed_internal::bit_width(ax > ay ? ax : ay);
+		if (w < 61) {
+			vx <<= (61 - w);
+			vy <<= (61 - w);
+		} else if (w > 61) {
+			vx >>= (w - 61);
+			vy >>= (w - 61);
+		}
+		int64_t z61;
+		if (vx == 0) {
+			z61 = vy >= 0 ? (cc0::fixed_internal::PI_2_Q62 >> 1) : -(cc0::fixed_internal::PI_2_Q62 >> 1);
+		} else {
+			const int64_t core = cc0::fixed_internal::cordic_vector(vx < 0 ? -vx : vx, vy) >> 1;
+			z61 = vx >= 0 ? core : (vy >= 0 ? cc0::fixed_internal::PI_Q61 - core : -cc0::fixed_internal::PI_Q61 - core);
+		}
+		out.value_bits = int_t(cc0::fixed_internal::rescale_q(z61, 61, precision));
+		return out;
+	}
+}
+
+#endif
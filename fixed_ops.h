@@ -0,0 +1,115 @@
+/// @file fixed_ops.h
+/// @brief Contains branchless selection primitives (abs, min, max, clamp, sign, copysign) over fixed-point numbers, written as sign-mask and compare-select idioms that compilers lower to conditional-move or vector-select instructions instead of branches.
+/// @author github.com/SirJonthe
+/// @date 2025
+/// @copyright Public domain.
+/// @license CC0 1.0
+
+#ifndef CC0_FIXED_OPS_H_INCLUDED__
+#define CC0_FIXED_OPS_H_INCLUDED__
+
+#include <cstdint>
+
+#include "fixed.h"
+
+namespace cc0
+{
+	/// @brief Branchless primitives over fixed-point numbers. All of them compile to straight-line arithmetic on value_bits with no data-dependent branches, which keeps tight loops free of mispredictions.
+	namespace fixed_ops
+	{
+		/// @brief Computes the absolute value of a fixed-point number through the sign-mask xor/subtract idiom.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param f The number.
+		/// @return The absolute value.
+		/// @note The lowest representable value has no positive counterpart and wraps onto itself.
+		template < uint32_t bits, uint32_t precision >
+		CC0_FIXED_CONSTEXPR cc0::fixed<bits,precision> abs(cc0::fixed<bits,precision> f)
+		{
+			typedef typename cc0::fixed_internal::intinfo<bits>::int_t  int_t;
+			typedef typename cc0::fixed_internal::intinfo<bits>::uint_t uint_t;
+			const uint_t mask = uint_t(f.value_bits >> (bits - 1));
+			f.value_bits = int_t(uint_t(uint_t(f.value_bits) ^ mask) - mask);
+			return f;
+		}
+
+		/// @brief Selects the smaller of two fixed-point numbers through the compare-select idiom.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param a The left-hand side operand.
+		/// @param b The right-hand side operand.
+		/// @return The smaller number.
+		template < uint32_t bits, uint32_t precision >
+		CC0_FIXED_CONSTEXPR cc0::fixed<bits,precision> min(cc0::fixed<bits,precision> a, cc0::fixed<bits,precision> b)
+		{
+			typedef typename cc0::fixed_internal::intinfo<bits>::int_t  int_t;
+			typedef typename cc0::fixed_internal::intinfo<bits>::uint_t uint_t;
+			const uint_t mask = uint_t(0) - uint_t(a.value_bits < b.value_bits);
+			a.value_bits = int_t(uint_t(b.value_bits) ^ (uint_t(uint_t(a.value_bits) ^ uint_t(b.value_bits)) & mask));
+			return a;
+		}
+
+		/// @brief Selects the larger of two fixed-point numbers through the compare-select idiom.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param a The left-hand side operand.
+		/// @param b The right-hand side operand.
+		/// @return The larger number.
+		template < uint32_t bits, uint32_t precision >
+		CC0_FIXED_CONSTEXPR cc0::fixed<bits,precision> max(cc0::fixed<bits,precision> a, cc0::fixed<bits,precision> b)
+		{
+			typedef typename cc0::fixed_internal::intinfo<bits>::int_t  int_t;
+			typedef typename cc0::fixed_internal::intinfo<bits>::uint_t uint_t;
+			const uint_t mask = uint_t(0) - uint_t(a.value_bits < b.value_bits);
+			a.value_bits = int_t(uint_t(a.value_bits) ^ (uint_t(uint_t(a.value_bits) ^ uint_t(b.value_bits)) & mask));
+			return a;
+		}
+
+		/// @brief Clamps a fixed-point number into an inclusive range.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param f The number.
+		/// @param lo The smallest allowed value.
+		/// @param hi The largest allowed value. Must not be smaller than lo.
+		/// @return The clamped number.
+		template < uint32_t bits, uint32_t precision >
+		CC0_FIXED_CONSTEXPR cc0::fixed<bits,precision> clamp(cc0::fixed<bits,precision> f, cc0::fixed<bits,precision> lo, cc0::fixed<bits,precision> hi)
+		{
+			return min(max(f, lo), hi);
+		}
+
+		/// @brief Computes the sign of a fixed-point number.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param f The number.
+		/// @return One for positive numbers, minus one for negative numbers, and zero for zero.
+		template < uint32_t bits, uint32_t precision >
+		CC0_FIXED_CONSTEXPR cc0::fixed<bits,precision> sign(cc0::fixed<bits,precision> f)
+		{
+			typedef typename cc0::fixed_internal::intinfo<bits>::int_t  int_t;
+			typedef typename cc0::fixed_internal::intinfo<bits>::uint_t uint_t;
+			f.value_bits = int_t(uint_t(uint_t(f.value_bits > int_t(0)) - uint_t(f.value_bits < int_t(0))) << precision);
+			return f;
+		}
+
+		/// @brief Combines the magnitude of one fixed-point number with the sign of another through the sign-mask idiom.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param mag The number supplying the magnitude.
+		/// @param sgn The number supplying the sign. Zero counts as positive.
+		/// @return The combined number.
+		/// @note The lowest representable value has no positive counterpart and wraps onto itself.
+		template < uint32_t bits, uint32_t precision >
+		CC0_FIXED_CONSTEXPR cc0::fixed<bits,precision> copysign(cc0::fixed<bits,precision> mag, cc0::fixed<bits,precision> sgn)
+		{
+			typedef typename cc0::fixed_internal::intinfo<bits>::int_t  int_t;
+			typedef typename cc0::fixed_internal::intinfo<bits>::uint_t uint_t;
+			const uint_t mask = uint_t(sgn.value_bits >> (bits - 1));
+			mag = abs(mag);
+			mag.value_bits = int_t(uint_t(uint_t(mag.value_bits) ^ mask) - mask);
+			return mag;
+		}
+	}
+}
+
+#endif
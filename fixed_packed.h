@@ -0,0 +1,114 @@
+/// @file fixed_packed.h
+/// @brief Contains a bit-packed storage adapter for arrays of fixed-point numbers whose meaningful bits are narrower than their base type, so large datasets only spend memory and cache on the bits that carry information.
+/// @author github.com/SirJonthe
+/// @date 2025
+/// @copyright Public domain.
+/// @license CC0 1.0
+
+#ifndef CC0_FIXED_PACKED_H_INCLUDED__
+#define CC0_FIXED_PACKED_H_INCLUDED__
+
+#include <cstdint>
+
+#include "fixed.h"
+
+namespace cc0
+{
+	/// @brief An adapter presenting a caller-provided word buffer as an array of fixed-point numbers of which only the low stored_bits of each bit representation are kept, packed contiguously with no padding. Values are sign-extended through the signed base type on read, so any value whose magnitude fits the stored width round-trips exactly, negative ones included. The adapter does not own the buffer, so it works directly over mapped files.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	/// @tparam stored_bits The number of bits kept per element. Must be between 1 and bits.
+	template < uint32_t bits, uint32_t precision, uint32_t stored_bits >
+	class fixed_packed_array
+	{
+	private:
+		typedef typename cc0::fixed_internal::intinfo<bits>::int_t int_t;
+
+		static constexpr uint64_t MASK = stored_bits < 64 ? (uint64_t(1) << stored_bits) - 1 : ~uint64_t(0); // The mask of one stored element.
+
+	private:
+		uint64_t *m_words; // The packed storage, not owned by the adapter.
+		uint64_t  m_size;  // The number of elements.
+
+		/// @brief Extracts the stored bits of one element, which may straddle a word boundary.
+		/// @param i The index of the element.
+		/// @return The stored bits.
+		uint64_t extract(uint64_t i) const
+		{
+			const uint64_t pos = i * stored_bits;
+			const uint32_t off = uint32_t(pos & 63);
+			uint64_t r = m_words[pos >> 6] >> off;
+			if (off + stored_bits > 64) {
+				r |= m_words[(pos >> 6) + 1] << (64 - off);
+			}
+			return r & MASK;
+		}
+
+	public:
+		/// @brief The number of words a packed array of a given size occupies, for the caller to size the buffer with.
+		/// @param size The number of elements.
+		/// @return The number of 64-bit words.
+		static constexpr uint64_t storage_words(uint64_t size) { return (size * stored_bits + 63) >> 6; }
+
+		/// @brief Constructs an adapter over a word buffer.
+		/// @param words The packed storage. Must hold storage_words(size) words.
+		/// @param size The number of elements.
+		fixed_packed_array(uint64_t *words, uint64_t size) : m_words(words), m_size(size) {}
+
+		/// @brief The number of elements.
+		/// @return The number of elements.
+		uint64_t size( void ) const { return m_size; }
+
+		/// @brief Reads one element, sign-extending the stored bits into the full base type.
+		/// @param i The index of the element.
+		/// @return The unpacked fixed-point number.
+		cc0::fixed<bits,precision> get(uint64_t i) const
+		{
+			const int64_t s = int64_t(extract(i) << (64 - stored_bits)) >> (64 - stored_bits);
+			return cc0::fixed<bits,precision>::from_bits(int_t(s));
+		}
+
+		/// @brief Writes one element, keeping only the low stored_bits of its bit representation.
+		/// @param i The index of the element.
+		/// @param f The fixed-point number to store. Its bit representation must fit stored_bits as a signed value to round-trip exactly.
+		void set(uint64_t i, cc0::fixed<bits,precision> f)
+		{
+			const uint64_t v   = uint64_t(f.value_bits) & MASK;
+			const uint64_t pos = i * stored_bits;
+			const uint32_t off = uint32_t(pos & 63);
+			m_words[pos >> 6] = (m_words[pos >> 6] & ~(MASK << off)) | (v << off);
+			if (off + stored_bits > 64) {
+				m_words[(pos >> 6) + 1] = (m_words[(pos >> 6) + 1] & ~(MASK >> (64 - off))) | (v >> (64 - off));
+			}
+		}
+
+		/// @brief Unpacks a run of elements into an array of fixed-point numbers. The packed words are read sequentially and the shift/mask/sign-extend per element carries no branches, so the loop vectorizes and a cache line of packed data expands in one pass.
+		/// @param dst The destination array. Must hold n elements.
+		/// @param first The index of the first element to unpack.
+		/// @param n The number of elements to unpack.
+		void unpack(cc0::fixed<bits,precision> *dst, uint64_t first, uint64_t n) const
+		{
+			for (uint64_t i = 0; i < n; ++i) {
+				const uint64_t pos = (first + i) * stored_bits;
+				const uint32_t off = uint32_t(pos & 63);
+				const uint64_t r   = off + stored_bits > 64
+					? (m_words[pos >> 6] >> off) | (m_words[(pos >> 6) + 1] << (64 - off))
+					: m_words[pos >> 6] >> off;
+				dst[i].value_bits = int_t(int64_t((r & MASK) << (64 - stored_bits)) >> (64 - stored_bits));
+			}
+		}
+
+		/// @brief Packs a run of fixed-point numbers into the array.
+		/// @param first The index of the first element to pack into.
+		/// @param src The source array. Each bit representation must fit stored_bits as a signed value to round-trip exactly.
+		/// @param n The number of elements to pack.
+		void pack(uint64_t first, const cc0::fixed<bits,precision> *src, uint64_t n)
+		{
+			for (uint64_t i = 0; i < n; ++i) {
+				set(first + i, src[i]);
+			}
+		}
+	};
+}
+
+#endif
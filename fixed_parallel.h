@@ -0,0 +1,141 @@
+/// @file fixed_parallel.h
+/// @brief Contains multi-threaded transform and reduce primitives over contiguous arrays of fixed-point numbers.
+/// @author github.com/SirJonthe
+/// @date 2025
+/// @copyright Public domain.
+/// @license CC0 1.0
+
+#ifndef CC0_FIXED_PARALLEL_H_INCLUDED__
+#define CC0_FIXED_PARALLEL_H_INCLUDED__
+
+#include <cstdint>
+#include <thread>
+
+#include "fixed.h"
+
+namespace cc0
+{
+	/// @brief Multi-threaded primitives over contiguous arrays of fixed-point numbers. Since fixed is a trivially copyable wrapper over a single integer, arrays can be partitioned between threads without any synchronization beyond the final join.
+	namespace fixed_parallel
+	{
+		/// @brief For internal use only.
+		namespace internal
+		{
+			/// @brief The smallest number of elements worth handing to one thread. Below this the work is done on the calling thread, since spawning costs more than it saves.
+			static const uint64_t MIN_PER_THREAD = 4096;
+
+			/// @brief A widened per-thread partial sum padded out to its own cache line so concurrent writers do not invalidate each other's lines.
+			/// @tparam bits The total number of bits for the base data type.
+			template < uint32_t bits >
+			struct alignas(64) padded_sum
+			{
+				typename cc0::fixed_internal::intinfo<bits>::next::int_t sum; // The widened partial sum of the bit representations.
+			};
+
+			/// @brief Determines how many threads to use for a workload.
+			/// @param n The number of elements in the workload.
+			/// @param threads The requested number of threads, or zero to use one per hardware thread.
+			/// @return The number of threads to use. At least one.
+			inline uint32_t thread_count(uint64_t n, uint32_t threads)
+			{
+				if (threads == 0) {
+					const unsigned int hw = std::thread::hardware_concurrency();
+					threads = hw > 0 ? uint32_t(hw) : 1;
+				}
+				const uint64_t max_useful = n / MIN_PER_THREAD;
+				if (uint64_t(threads) > max_useful) { threads = uint32_t(max_useful); }
+				return threads > 0 ? threads : 1;
+			}
+
+			/// @brief Computes the first element index of one thread's chunk, rounded down to a cache-line boundary so no two threads write to the same line.
+			/// @tparam bits The total number of bits for the base data type.
+			/// @param n The number of elements in the workload.
+			/// @param threads The number of threads.
+			/// @param t The index of the thread.
+			/// @return The first element index of the chunk. The chunk ends where thread t+1's chunk begins, and the last chunk ends at n.
+			template < uint32_t bits >
+			uint64_t chunk_begin(uint64_t n, uint32_t threads, uint32_t t)
+			{
+				const uint64_t per_line = 64 / (bits / 8);
+				const uint64_t begin    = (n * t) / threads;
+				return t > 0 ? (begin / per_line) * per_line : 0;
+			}
+		}
+
+		/// @brief Applies a function to every element of an array, writing the results to a destination array, with the work partitioned across multiple threads.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @tparam func_t The function type, taking one fixed-point number and returning one fixed-point number.
+		/// @param dst The destination array. May alias src.
+		/// @param src The source array.
+		/// @param n The number of elements to process.
+		/// @param func The function to apply to each element.
+		/// @param threads The number of threads to use, or zero to use one per hardware thread. Small workloads run on the calling thread regardless.
+		template < uint32_t bits, uint32_t precision, typename func_t >
+		void transform(cc0::fixed<bits,precision> *dst, const cc0::fixed<bits,precision> *src, uint64_t n, func_t func, uint32_t threads = 0)
+		{
+			const uint32_t tc = internal::thread_count(n, threads);
+			if (tc == 1) {
+				for (uint64_t i = 0; i < n; ++i) { dst[i] = func(src[i]); }
+				return;
+			}
+			std::thread workers[64];
+			const uint32_t spawned = tc <= 64 ? tc - 1 : 63;
+			for (uint32_t t = 0; t < spawned; ++t) {
+				const uint64_t begin = internal::chunk_begin<bits>(n, spawned + 1, t);
+				const uint64_t end   = internal::chunk_begin<bits>(n, spawned + 1, t + 1);
+				workers[t] = std::thread([=]() {
+					for (uint64_t i = begin; i < end; ++i) { dst[i] = func(src[i]); }
+				});
+			}
+			for (uint64_t i = internal::chunk_begin<bits>(n, spawned + 1, spawned); i < n; ++i) { dst[i] = func(src[i]); }
+			for (uint32_t t = 0; t < spawned; ++t) { workers[t].join(); }
+		}
+
+		/// @brief Sums every element of an array, with the work partitioned across multiple threads. Each thread accumulates into a widened per-thread partial sum, so neither the chunking nor the reduction order can overflow before the final narrowing.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param src The source array.
+		/// @param n The number of elements to sum.
+		/// @param threads The number of threads to use, or zero to use one per hardware thread. Small workloads run on the calling thread regardless.
+		/// @return The sum.
+		/// @note For 64-bit base types the widened partial sums alias the base type, so very long runs of large-magnitude values can still wrap, just like chained operator+=.
+		template < uint32_t bits, uint32_t precision >
+		cc0::fixed<bits,precision> reduce(const cc0::fixed<bits,precision> *src, uint64_t n, uint32_t threads = 0)
+		{
+			typedef typename cc0::fixed_internal::intinfo<bits>::next::int_t wide_t;
+			const uint32_t tc = internal::thread_count(n, threads);
+			internal::padded_sum<bits> partials[64];
+			const uint32_t chunks = tc <= 64 ? tc : 64;
+			if (chunks == 1) {
+				wide_t sum = 0;
+				for (uint64_t i = 0; i < n; ++i) { sum += src[i].value_bits; }
+				cc0::fixed<bits,precision> out;
+				out.value_bits = typename cc0::fixed_internal::intinfo<bits>::int_t(sum);
+				return out;
+			}
+			std::thread workers[64];
+			for (uint32_t t = 0; t < chunks - 1; ++t) {
+				const uint64_t begin = internal::chunk_begin<bits>(n, chunks, t);
+				const uint64_t end   = internal::chunk_begin<bits>(n, chunks, t + 1);
+				internal::padded_sum<bits> *partial = partials + t;
+				workers[t] = std::thread([=]() {
+					wide_t sum = 0;
+					for (uint64_t i = begin; i < end; ++i) { sum += src[i].value_bits; }
+					partial->sum = sum;
+				});
+			}
+			wide_t total = 0;
+			for (uint64_t i = internal::chunk_begin<bits>(n, chunks, chunks - 1); i < n; ++i) { total += src[i].value_bits; }
+			for (uint32_t t = 0; t < chunks - 1; ++t) {
+				workers[t].join();
+				total += partials[t].sum;
+			}
+			cc0::fixed<bits,precision> out;
+			out.value_bits = typename cc0::fixed_internal::intinfo<bits>::int_t(total);
+			return out;
+		}
+	}
+}
+
+#endif
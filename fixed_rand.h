@@ -0,0 +1,132 @@
+/// @file fixed_rand.h
+/// @brief Contains a fast integer random number generator whose draws feed fixed-point bit representations directly, with no floating-point round-trip anywhere. Runs are bit-reproducible across machines for a given seed.
+/// @author github.com/SirJonthe
+/// @date 2025
+/// @copyright Public domain.
+/// @license CC0 1.0
+
+#ifndef CC0_FIXED_RAND_H_INCLUDED__
+#define CC0_FIXED_RAND_H_INCLUDED__
+
+#include <cstdint>
+
+#include "fixed.h"
+
+namespace cc0
+{
+	/// @brief For internal use only.
+	namespace fixed_internal
+	{
+		/// @brief Rotates a 64-bit number left.
+		/// @param x The number.
+		/// @param k The number of bits to rotate by. Must be between 1 and 63.
+		/// @return The rotated number.
+		inline uint64_t rotl64(uint64_t x, uint32_t k)
+		{
+			return (x << k) | (x >> (64 - k));
+		}
+
+		/// @brief Mixes a 64-bit number into a well-distributed 64-bit number (the splitmix64 finalizer). Used to expand one seed into the generator state so that similar seeds do not produce correlated streams.
+		/// @param x The number to mix.
+		/// @return The mixed number.
+		inline uint64_t splitmix64(uint64_t &x)
+		{
+			uint64_t z = (x += UINT64_C(0x9E3779B97F4A7C15));
+			z = (z ^ (z >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+			z = (z ^ (z >> 27)) * UINT64_C(0x94D049BB133111EB);
+			return z ^ (z >> 31);
+		}
+	}
+
+	/// @brief A random number generator producing fixed-point numbers directly from an integer stream (xoshiro256**), with uniform ranges mapped through the same widened multiply the arithmetic operators use rather than through modulo or floating point.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	template < uint32_t bits, uint32_t precision >
+	class fixed_rand
+	{
+	private:
+		typedef typename cc0::fixed_internal::intinfo<bits>::int_t  int_t;
+		typedef typename cc0::fixed_internal::intinfo<bits>::uint_t uint_t;
+
+	private:
+		uint64_t m_state[4]; // The xoshiro256** generator state.
+
+	private:
+		/// @brief Advances the generator.
+		/// @return 64 uniformly distributed bits.
+		uint64_t next( void )
+		{
+			const uint64_t out = cc0::fixed_internal::rotl64(m_state[1] * 5, 7) * 9;
+			const uint64_t t   = m_state[1] << 17;
+			m_state[2] ^= m_state[0];
+			m_state[3] ^= m_state[1];
+			m_state[1] ^= m_state[2];
+			m_state[0] ^= m_state[3];
+			m_state[2] ^= t;
+			m_state[3] = cc0::fixed_internal::rotl64(m_state[3], 45);
+			return out;
+		}
+
+		/// @brief Scales a full-width random draw into an offset within a range through the widened multiply, avoiding the bias and the divide of the modulo method.
+		/// @param range The size of the range as a bit representation.
+		/// @return A uniformly distributed bit representation in [0, range).
+		uint_t scale(uint_t range)
+		{
+			const uint_t x = uint_t(next() >> (64 - bits));
+			if (bits == 64) {
+				uint64_t hi, lo;
+				cc0::fixed_internal::umul128(uint64_t(range), uint64_t(x), hi, lo);
+				return uint_t(hi);
+			}
+			return uint_t((typename cc0::fixed_internal::intinfo<bits>::next::uint_t(range) * x) >> (bits & 63)); // The masked shift only matters for the 64-bit instantiation, where this path is never taken.
+		}
+
+	public:
+		/// @brief Seeds the generator. Equal seeds produce equal streams on every platform.
+		/// @param seed The seed. Any value is fine, including zero.
+		explicit fixed_rand(uint64_t seed = 0)
+		{
+			for (uint32_t i = 0; i < 4; ++i) {
+				m_state[i] = cc0::fixed_internal::splitmix64(seed);
+			}
+		}
+
+		/// @brief Draws a uniformly distributed fixed-point number in [0, 1).
+		/// @return The drawn number.
+		/// @note Every representable value in the range is equally likely. For a precision of zero the only representable value in the range is zero.
+		cc0::fixed<bits,precision> uniform( void )
+		{
+			cc0::fixed<bits,precision> out;
+			out.value_bits = int_t(precision > 0 ? uint_t(next() >> ((64 - precision) & 63)) : uint_t(0));
+			return out;
+		}
+
+		/// @brief Draws a uniformly distributed fixed-point number in [lo, hi).
+		/// @param lo The smallest value that can be drawn.
+		/// @param hi The value one past the largest that can be drawn. Must not be smaller than lo.
+		/// @return The drawn number.
+		cc0::fixed<bits,precision> uniform(cc0::fixed<bits,precision> lo, cc0::fixed<bits,precision> hi)
+		{
+			cc0::fixed<bits,precision> out;
+			out.value_bits = int_t(uint_t(lo.value_bits) + scale(uint_t(hi.value_bits) - uint_t(lo.value_bits)));
+			return out;
+		}
+
+		/// @brief Draws an approximately standard-normal fixed-point number by summing twelve uniform draws and centering (the central limit approximation). Mean zero, variance one, no values beyond six.
+		/// @return The drawn number.
+		/// @note The central limit sum is accurate to roughly two decimal places in the distribution body and cuts the tails off at six standard deviations, which is usually acceptable for Monte Carlo aggregates. The draws are summed at 60 fractional bits so the sum cannot overflow, then shifted into the target precision.
+		cc0::fixed<bits,precision> normal( void )
+		{
+			int64_t sum = 0;
+			for (uint32_t i = 0; i < 12; ++i) {
+				sum += int64_t(next() >> 4);
+			}
+			sum -= int64_t(6) << 60;
+			cc0::fixed<bits,precision> out;
+			out.value_bits = int_t(precision > 60 ? int64_t(uint64_t(sum) << ((precision - 60) & 63)) : sum >> ((60 - precision) & 63));
+			return out;
+		}
+	};
+}
+
+#endif
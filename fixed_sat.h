@@ -0,0 +1,297 @@
+/// @file fixed_sat.h
+/// @brief Contains a saturating variant of the fixed-point data type whose arithmetic clamps to the representable range instead of wrapping.
+/// @author github.com/SirJonthe
+/// @date 2025
+/// @copyright Public domain.
+/// @license CC0 1.0
+
+#ifndef CC0_FIXED_SAT_H_INCLUDED__
+#define CC0_FIXED_SAT_H_INCLUDED__
+
+#include <cstdint>
+
+#include "fixed.h"
+
+namespace cc0
+{
+	/// @brief For internal use only.
+	namespace fixed_internal
+	{
+		/// @brief Saturating arithmetic on fixed-point bit representations, implemented with branchless widened compares that compilers can lower to conditional-select instructions.
+		/// @tparam bits The number of bits of the base data type.
+		template < uint32_t bits >
+		struct sat_ops
+		{
+			typedef typename intinfo<bits>::int_t        int_t;
+			typedef typename intinfo<bits>::uint_t       uint_t;
+			typedef typename intinfo<bits>::next::int_t  wide_t;
+
+			static constexpr int_t MAX = int_t((uint_t(1) << (bits - 1)) - 1); // The largest representable bit pattern.
+			static constexpr int_t MIN = int_t(uint_t(1) << (bits - 1));       // The smallest representable bit pattern.
+
+			/// @brief Clamps a widened value to the representable range of the base type.
+			/// @param n The widened value.
+			/// @return The clamped value.
+			static int_t clamp(wide_t n) {
+				n = n > wide_t(MAX) ? wide_t(MAX) : n;
+				n = n < wide_t(MIN) ? wide_t(MIN) : n;
+				return int_t(n);
+			}
+
+			/// @brief Saturating addition.
+			/// @param a The left-hand side bit representation.
+			/// @param b The right-hand side bit representation.
+			/// @return The clamped sum.
+			static int_t add(int_t a, int_t b) { return clamp(wide_t(a) + b); }
+
+			/// @brief Saturating subtraction.
+			/// @param a The left-hand side bit representation.
+			/// @param b The right-hand side bit representation.
+			/// @return The clamped difference.
+			static int_t sub(int_t a, int_t b) { return clamp(wide_t(a) - b); }
+
+			/// @brief Saturating fixed-point multiplication.
+			/// @param a The left-hand side bit representation.
+			/// @param b The right-hand side bit representation.
+			/// @param precision The number of bits dedicated to decimals.
+			/// @return The clamped, downscaled product.
+			static int_t mul(int_t a, int_t b, uint32_t precision) { return clamp((wide_t(a) * b) >> precision); }
+
+			/// @brief Saturating fixed-point division.
+			/// @param a The left-hand side bit representation.
+			/// @param b The right-hand side bit representation.
+			/// @param precision The number of bits dedicated to decimals.
+			/// @return The clamped, upscaled quotient.
+			static int_t div(int_t a, int_t b, uint32_t precision) { return clamp((wide_t(a) << precision) / b); }
+		};
+
+		/// @brief Saturating arithmetic on 64-bit fixed-point bit representations. There is no wider base type, so overflow is detected through sign analysis and the 128-bit product helpers.
+		template <>
+		struct sat_ops<64>
+		{
+			typedef int64_t int_t;
+
+			static constexpr int_t MAX = INT64_MAX; // The largest representable bit pattern.
+			static constexpr int_t MIN = INT64_MIN; // The smallest representable bit pattern.
+
+			/// @brief Saturating addition.
+			/// @param a The left-hand side bit representation.
+			/// @param b The right-hand side bit representation.
+			/// @return The clamped sum.
+			static int_t add(int_t a, int_t b) {
+				const int_t r = int_t(uint64_t(a) + uint64_t(b));
+				return ((a ^ r) & (b ^ r)) < 0 ? (a < 0 ? MIN : MAX) : r;
+			}
+
+			/// @brief Saturating subtraction.
+			/// @param a The left-hand side bit representation.
+			/// @param b The right-hand side bit representation.
+			/// @return The clamped difference.
+			static int_t sub(int_t a, int_t b) {
+				const int_t r = int_t(uint64_t(a) - uint64_t(b));
+				return ((a ^ b) & (a ^ r)) < 0 ? (a < 0 ? MIN : MAX) : r;
+			}
+
+			/// @brief Saturating fixed-point multiplication.
+			/// @param a The left-hand side bit representation.
+			/// @param b The right-hand side bit representation.
+			/// @param precision The number of bits dedicated to decimals.
+			/// @return The clamped, downscaled product.
+			static int_t mul(int_t a, int_t b, uint32_t precision) {
+				int64_t  hi;
+				uint64_t lo;
+				imul128(a, b, hi, lo);
+				const int_t s_lo = precision > 0 ? int_t((lo >> precision) | (uint64_t(hi) << (64 - precision))) : int_t(lo);
+				const int_t s_hi = precision > 0 ? (hi >> precision) : hi;
+				// The downscaled 128-bit product fits when its high word is just the sign extension of its low word.
+				return s_hi == (s_lo >> 63) ? s_lo : ((a < 0) != (b < 0) ? MIN : MAX);
+			}
+
+			/// @brief Saturating fixed-point division.
+			/// @param a The left-hand side bit representation.
+			/// @param b The right-hand side bit representation.
+			/// @param precision The number of bits dedicated to decimals.
+			/// @return The clamped, upscaled quotient.
+			static int_t div(int_t a, int_t b, uint32_t precision) {
+				const int_t n = int_t(uint64_t(a) << precision);
+				if ((n >> precision) != a) {
+					return (a < 0) != (b < 0) ? MIN : MAX;
+				}
+				return a == MIN && b == -1 ? MAX : n / b;
+			}
+		};
+	}
+
+	/// @brief A fixed-point number whose arithmetic saturates to the smallest and largest representable values instead of wrapping. Layout-compatible with fixed, i.e. a single value_bits member, so buffers can be reinterpreted between the two.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	template < uint32_t bits, uint32_t precision >
+	class fixed_sat
+	{
+	private:
+		typedef typename cc0::fixed_internal::intinfo<bits>::int_t  int_t;
+		typedef typename cc0::fixed_internal::intinfo<bits>::uint_t uint_t;
+		typedef cc0::fixed_internal::sat_ops<bits>                  ops;
+
+	public:
+		int_t value_bits; // The binary representation of the fixed-point number.
+
+		/// @brief The default constructor. Does nothing, and does not initialize the instance.
+		fixed_sat( void ) = default;
+
+		/// @brief The copy constructor.
+		/// @param NA The instance to copy.
+		fixed_sat(const fixed_sat&) = default;
+
+		/// @brief The copy operator.
+		/// @param NA The instance to copy.
+		/// @return The result.
+		fixed_sat &operator=(const fixed_sat&) = default;
+
+		/// @brief A conversion constructor that converts an integer into a fixed-point number by upscaling it, clamping on overflow.
+		/// @param n The number to upscale into a fixed-point number.
+		fixed_sat(int_t n) : value_bits(int_t(uint64_t(n) << precision)) {
+			if ((int64_t(value_bits) >> precision) != int64_t(n)) {
+				value_bits = n < 0 ? ops::MIN : ops::MAX;
+			}
+		}
+
+		/// @brief Converts two integers into a fixed-point number.
+		/// @param i The integer part of the number.
+		/// @param d The fractional part of the number in base 10.
+		/// @note The fractional parameter is scaled properly, meaning 9 is the same as 90, 900, 9000, etc.
+		fixed_sat(int_t i, uint_t d) : value_bits(cc0::fixed<bits,precision>(i, d).value_bits) {}
+
+		/// @brief A conversion constructor reinterpreting a plain fixed-point number.
+		/// @param f The fixed-point number.
+		explicit fixed_sat(cc0::fixed<bits,precision> f) : value_bits(f.value_bits) {}
+
+		/// @brief A conversion operator reinterpreting the number as a plain fixed-point number.
+		operator cc0::fixed<bits,precision>( void ) const {
+			cc0::fixed<bits,precision> out;
+			out.value_bits = value_bits;
+			return out;
+		}
+
+		/// @brief A conversion operator converting the fixed-point number into an integer by downscaling it.
+		explicit operator int_t( void ) const { return value_bits >> precision; }
+
+		/// @brief Saturating addition.
+		/// @param r The right-hand side operator.
+		/// @return The result.
+		fixed_sat &operator+=(fixed_sat r) { value_bits = ops::add(value_bits, r.value_bits); return *this; }
+
+		/// @brief Saturating subtraction.
+		/// @param r The right-hand side operator.
+		/// @return The result.
+		fixed_sat &operator-=(fixed_sat r) { value_bits = ops::sub(value_bits, r.value_bits); return *this; }
+
+		/// @brief Saturating multiplication.
+		/// @param r The right-hand side operator.
+		/// @return The result.
+		fixed_sat &operator*=(fixed_sat r) { value_bits = ops::mul(value_bits, r.value_bits, precision); return *this; }
+
+		/// @brief Saturating division.
+		/// @param r The right-hand side operator.
+		/// @return The result.
+		fixed_sat &operator/=(fixed_sat r) { value_bits = ops::div(value_bits, r.value_bits, precision); return *this; }
+
+		/// @brief Pre-increment.
+		/// @return A reference to the state of the variable after increment.
+		fixed_sat &operator++( void ) { return *this += fixed_sat(int_t(1)); }
+
+		/// @brief Post-increment.
+		/// @return The state of the variable before increment.
+		fixed_sat operator++( int ) { auto t = *this; *this += fixed_sat(int_t(1)); return t; }
+
+		/// @brief Pre-decrement.
+		/// @return A reference to the state of the variable after decrement.
+		fixed_sat &operator--( void ) { return *this -= fixed_sat(int_t(1)); }
+
+		/// @brief Post-decrement.
+		/// @return The state of the variable before decrement.
+		fixed_sat operator--( int ) { auto t = *this; *this -= fixed_sat(int_t(1)); return t; }
+	};
+}
+
+/// @brief Saturating addition.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline cc0::fixed_sat<bits,precision> operator+(cc0::fixed_sat<bits,precision> l, cc0::fixed_sat<bits,precision> r) { return l += r; }
+
+/// @brief Saturating subtraction.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline cc0::fixed_sat<bits,precision> operator-(cc0::fixed_sat<bits,precision> l, cc0::fixed_sat<bits,precision> r) { return l -= r; }
+
+/// @brief Saturating multiplication.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline cc0::fixed_sat<bits,precision> operator*(cc0::fixed_sat<bits,precision> l, cc0::fixed_sat<bits,precision> r) { return l *= r; }
+
+/// @brief Saturating division.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline cc0::fixed_sat<bits,precision> operator/(cc0::fixed_sat<bits,precision> l, cc0::fixed_sat<bits,precision> r) { return l /= r; }
+
+/// @brief Equality.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline bool operator==(cc0::fixed_sat<bits,precision> l, cc0::fixed_sat<bits,precision> r) { return l.value_bits == r.value_bits; }
+
+/// @brief Inequality.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline bool operator!=(cc0::fixed_sat<bits,precision> l, cc0::fixed_sat<bits,precision> r) { return l.value_bits != r.value_bits; }
+
+/// @brief Less than.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline bool operator<(cc0::fixed_sat<bits,precision> l, cc0::fixed_sat<bits,precision> r) { return l.value_bits < r.value_bits; }
+
+/// @brief Greater than.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline bool operator>(cc0::fixed_sat<bits,precision> l, cc0::fixed_sat<bits,precision> r) { return l.value_bits > r.value_bits; }
+
+/// @brief Less or equal.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline bool operator<=(cc0::fixed_sat<bits,precision> l, cc0::fixed_sat<bits,precision> r) { return l.value_bits <= r.value_bits; }
+
+/// @brief Greater or equal.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline bool operator>=(cc0::fixed_sat<bits,precision> l, cc0::fixed_sat<bits,precision> r) { return l.value_bits >= r.value_bits; }
+
+#endif
@@ -0,0 +1,267 @@
+/// @file fixed_simd.h
+/// @brief Contains batch arithmetic kernels that process contiguous arrays of fixed-point numbers several elements at a time.
+/// @author github.com/SirJonthe
+/// @date 2025
+/// @copyright Public domain.
+/// @license CC0 1.0
+
+#ifndef CC0_FIXED_SIMD_H_INCLUDED__
+#define CC0_FIXED_SIMD_H_INCLUDED__
+
+#include <cstdint>
+
+#include "fixed.h"
+
+#if defined(__AVX2__) || defined(__SSE2__)
+	#include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	#include <arm_neon.h>
+#endif
+
+namespace cc0
+{
+	/// @brief Batch kernels operating on contiguous arrays of fixed-point numbers.
+	/// @note Since fixed is a trivially copyable wrapper around a single integer, arrays of fixed are laid out exactly like arrays of the underlying integer type and can be processed several lanes at a time. Where the compiler exposes SSE2/AVX2/NEON the 32-bit kernels use explicit vector instructions; all other widths fall back to scalar loops written so that the widening intermediate stays in registers.
+	namespace fixed_simd
+	{
+		/// @brief Adds two arrays of fixed-point numbers element by element.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param dst The destination array. May alias a or b.
+		/// @param a The left-hand side array.
+		/// @param b The right-hand side array.
+		/// @param n The number of elements to process.
+		template < uint32_t bits, uint32_t precision >
+		void add(cc0::fixed<bits,precision> *dst, const cc0::fixed<bits,precision> *a, const cc0::fixed<bits,precision> *b, uint64_t n)
+		{
+			for (uint64_t i = 0; i < n; ++i) {
+				dst[i].value_bits = a[i].value_bits + b[i].value_bits;
+			}
+		}
+
+		/// @brief Multiplies two arrays of fixed-point numbers element by element.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param dst The destination array. May alias a or b.
+		/// @param a The left-hand side array.
+		/// @param b The right-hand side array.
+		/// @param n The number of elements to process.
+		template < uint32_t bits, uint32_t precision >
+		void mul(cc0::fixed<bits,precision> *dst, const cc0::fixed<bits,precision> *a, const cc0::fixed<bits,precision> *b, uint64_t n)
+		{
+			typedef typename cc0::fixed_internal::intinfo<bits>::next::int_t wide_t;
+			typedef typename cc0::fixed_internal::intinfo<bits>::int_t      int_t;
+			uint64_t i = 0;
+			for (; i + 4 <= n; i += 4) {
+				const wide_t n0 = wide_t(a[i  ].value_bits) * b[i  ].value_bits;
+				const wide_t n1 = wide_t(a[i+1].value_bits) * b[i+1].value_bits;
+				const wide_t n2 = wide_t(a[i+2].value_bits) * b[i+2].value_bits;
+				const wide_t n3 = wide_t(a[i+3].value_bits) * b[i+3].value_bits;
+				dst[i  ].value_bits = int_t(n0 >> precision);
+				dst[i+1].value_bits = int_t(n1 >> precision);
+				dst[i+2].value_bits = int_t(n2 >> precision);
+				dst[i+3].value_bits = int_t(n3 >> precision);
+			}
+			for (; i < n; ++i) {
+				dst[i].value_bits = int_t((wide_t(a[i].value_bits) * b[i].value_bits) >> precision);
+			}
+		}
+
+		/// @brief Multiplies two arrays of fixed-point numbers element by element and adds a third.
+		/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param dst The destination array. May alias a, b, or c.
+		/// @param a The left-hand side array of the multiplication.
+		/// @param b The right-hand side array of the multiplication.
+		/// @param c The array to add to the products.
+		/// @param n The number of elements to process.
+		template < uint32_t bits, uint32_t precision >
+		void mul_add(cc0::fixed<bits,precision> *dst, const cc0::fixed<bits,precision> *a, const cc0::fixed<bits,precision> *b, const cc0::fixed<bits,precision> *c, uint64_t n)
+		{
+			typedef typename cc0::fixed_internal::intinfo<bits>::next::int_t wide_t;
+			typedef typename cc0::fixed_internal::intinfo<bits>::int_t      int_t;
+			for (uint64_t i = 0; i < n; ++i) {
+				dst[i].value_bits = int_t((wide_t(a[i].value_bits) * b[i].value_bits) >> precision) + c[i].value_bits;
+			}
+		}
+
+#if defined(__AVX2__)
+
+		/// @brief Adds two arrays of 32-bit fixed-point numbers element by element, eight lanes at a time.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param dst The destination array. May alias a or b.
+		/// @param a The left-hand side array.
+		/// @param b The right-hand side array.
+		/// @param n The number of elements to process.
+		template < uint32_t precision >
+		void add(cc0::fixed<32,precision> *dst, const cc0::fixed<32,precision> *a, const cc0::fixed<32,precision> *b, uint64_t n)
+		{
+			uint64_t i = 0;
+			for (; i + 8 <= n; i += 8) {
+				const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+				const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_add_epi32(va, vb));
+			}
+			for (; i < n; ++i) {
+				dst[i].value_bits = a[i].value_bits + b[i].value_bits;
+			}
+		}
+
+		/// @brief For internal use only. Multiplies eight pairs of 32-bit fixed-point numbers via widened 64-bit products.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param va The left-hand side lanes.
+		/// @param vb The right-hand side lanes.
+		/// @return The eight downscaled products.
+		template < uint32_t precision >
+		inline __m256i mul_8lanes(__m256i va, __m256i vb)
+		{
+			const __m256i idx = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+			const __m256i alo = _mm256_cvtepi32_epi64(_mm256_castsi256_si128(va));
+			const __m256i ahi = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(va, 1));
+			const __m256i blo = _mm256_cvtepi32_epi64(_mm256_castsi256_si128(vb));
+			const __m256i bhi = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(vb, 1));
+			const __m256i plo = _mm256_srli_epi64(_mm256_mul_epi32(alo, blo), precision);
+			const __m256i phi = _mm256_srli_epi64(_mm256_mul_epi32(ahi, bhi), precision);
+			const __m128i rlo = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(plo, idx));
+			const __m128i rhi = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(phi, idx));
+			return _mm256_inserti128_si256(_mm256_castsi128_si256(rlo), rhi, 1);
+		}
+
+		/// @brief Multiplies two arrays of 32-bit fixed-point numbers element by element, eight lanes at a time.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param dst The destination array. May alias a or b.
+		/// @param a The left-hand side array.
+		/// @param b The right-hand side array.
+		/// @param n The number of elements to process.
+		/// @note Only the low 32 bits of each downscaled product are kept, so a logical 64-bit shift yields the same result as the arithmetic shift used by the scalar operator.
+		template < uint32_t precision >
+		void mul(cc0::fixed<32,precision> *dst, const cc0::fixed<32,precision> *a, const cc0::fixed<32,precision> *b, uint64_t n)
+		{
+			uint64_t i = 0;
+			for (; i + 8 <= n; i += 8) {
+				const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+				const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), mul_8lanes<precision>(va, vb));
+			}
+			for (; i < n; ++i) {
+				dst[i].value_bits = int32_t((int64_t(a[i].value_bits) * b[i].value_bits) >> precision);
+			}
+		}
+
+		/// @brief Multiplies two arrays of 32-bit fixed-point numbers element by element and adds a third, eight lanes at a time.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param dst The destination array. May alias a, b, or c.
+		/// @param a The left-hand side array of the multiplication.
+		/// @param b The right-hand side array of the multiplication.
+		/// @param c The array to add to the products.
+		/// @param n The number of elements to process.
+		template < uint32_t precision >
+		void mul_add(cc0::fixed<32,precision> *dst, const cc0::fixed<32,precision> *a, const cc0::fixed<32,precision> *b, const cc0::fixed<32,precision> *c, uint64_t n)
+		{
+			uint64_t i = 0;
+			for (; i + 8 <= n; i += 8) {
+				const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+				const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+				const __m256i vc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c + i));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_add_epi32(mul_8lanes<precision>(va, vb), vc));
+			}
+			for (; i < n; ++i) {
+				dst[i].value_bits = int32_t((int64_t(a[i].value_bits) * b[i].value_bits) >> precision) + c[i].value_bits;
+			}
+		}
+
+#elif defined(__SSE2__)
+
+		/// @brief Adds two arrays of 32-bit fixed-point numbers element by element, four lanes at a time.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param dst The destination array. May alias a or b.
+		/// @param a The left-hand side array.
+		/// @param b The right-hand side array.
+		/// @param n The number of elements to process.
+		template < uint32_t precision >
+		void add(cc0::fixed<32,precision> *dst, const cc0::fixed<32,precision> *a, const cc0::fixed<32,precision> *b, uint64_t n)
+		{
+			uint64_t i = 0;
+			for (; i + 4 <= n; i += 4) {
+				const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+				const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_add_epi32(va, vb));
+			}
+			for (; i < n; ++i) {
+				dst[i].value_bits = a[i].value_bits + b[i].value_bits;
+			}
+		}
+
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+
+		/// @brief Adds two arrays of 32-bit fixed-point numbers element by element, four lanes at a time.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param dst The destination array. May alias a or b.
+		/// @param a The left-hand side array.
+		/// @param b The right-hand side array.
+		/// @param n The number of elements to process.
+		template < uint32_t precision >
+		void add(cc0::fixed<32,precision> *dst, const cc0::fixed<32,precision> *a, const cc0::fixed<32,precision> *b, uint64_t n)
+		{
+			uint64_t i = 0;
+			for (; i + 4 <= n; i += 4) {
+				const int32x4_t va = vld1q_s32(reinterpret_cast<const int32_t*>(a + i));
+				const int32x4_t vb = vld1q_s32(reinterpret_cast<const int32_t*>(b + i));
+				vst1q_s32(reinterpret_cast<int32_t*>(dst + i), vaddq_s32(va, vb));
+			}
+			for (; i < n; ++i) {
+				dst[i].value_bits = a[i].value_bits + b[i].value_bits;
+			}
+		}
+
+		/// @brief Multiplies two arrays of 32-bit fixed-point numbers element by element, four lanes at a time via widened 64-bit products.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param dst The destination array. May alias a or b.
+		/// @param a The left-hand side array.
+		/// @param b The right-hand side array.
+		/// @param n The number of elements to process.
+		template < uint32_t precision >
+		void mul(cc0::fixed<32,precision> *dst, const cc0::fixed<32,precision> *a, const cc0::fixed<32,precision> *b, uint64_t n)
+		{
+			uint64_t i = 0;
+			for (; i + 4 <= n; i += 4) {
+				const int32x4_t va = vld1q_s32(reinterpret_cast<const int32_t*>(a + i));
+				const int32x4_t vb = vld1q_s32(reinterpret_cast<const int32_t*>(b + i));
+				const int64x2_t plo = vshrq_n_s64(vmull_s32(vget_low_s32(va),  vget_low_s32(vb)),  precision);
+				const int64x2_t phi = vshrq_n_s64(vmull_s32(vget_high_s32(va), vget_high_s32(vb)), precision);
+				vst1q_s32(reinterpret_cast<int32_t*>(dst + i), vcombine_s32(vmovn_s64(plo), vmovn_s64(phi)));
+			}
+			for (; i < n; ++i) {
+				dst[i].value_bits = int32_t((int64_t(a[i].value_bits) * b[i].value_bits) >> precision);
+			}
+		}
+
+		/// @brief Multiplies two arrays of 32-bit fixed-point numbers element by element and adds a third, four lanes at a time.
+		/// @tparam precision The number of bits dedicated to decimals.
+		/// @param dst The destination array. May alias a, b, or c.
+		/// @param a The left-hand side array of the multiplication.
+		/// @param b The right-hand side array of the multiplication.
+		/// @param c The array to add to the products.
+		/// @param n The number of elements to process.
+		template < uint32_t precision >
+		void mul_add(cc0::fixed<32,precision> *dst, const cc0::fixed<32,precision> *a, const cc0::fixed<32,precision> *b, const cc0::fixed<32,precision> *c, uint64_t n)
+		{
+			uint64_t i = 0;
+			for (; i + 4 <= n; i += 4) {
+				const int32x4_t va = vld1q_s32(reinterpret_cast<const int32_t*>(a + i));
+				const int32x4_t vb = vld1q_s32(reinterpret_cast<const int32_t*>(b + i));
+				const int32x4_t vc = vld1q_s32(reinterpret_cast<const int32_t*>(c + i));
+				const int64x2_t plo = vshrq_n_s64(vmull_s32(vget_low_s32(va),  vget_low_s32(vb)),  precision);
+				const int64x2_t phi = vshrq_n_s64(vmull_s32(vget_high_s32(va), vget_high_s32(vb)), precision);
+				vst1q_s32(reinterpret_cast<int32_t*>(dst + i), vaddq_s32(vcombine_s32(vmovn_s64(plo), vmovn_s64(phi)), vc));
+			}
+			for (; i < n; ++i) {
+				dst[i].value_bits = int32_t((int64_t(a[i].value_bits) * b[i].value_bits) >> precision) + c[i].value_bits;
+			}
+		}
+
+#endif
+	}
+}
+
+#endif
@@ -0,0 +1,331 @@
+/// @file fixed_traced.h
+/// @brief Contains an instrumented variant of the fixed-point data type that shadows every operation with a double reference value and records per-operation error and headroom statistics into a registry, for offline profiling when choosing a width and precision.
+/// @author github.com/SirJonthe
+/// @date 2025
+/// @copyright Public domain.
+/// @license CC0 1.0
+
+#ifndef CC0_FIXED_TRACED_H_INCLUDED__
+#define CC0_FIXED_TRACED_H_INCLUDED__
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+
+#include "fixed.h"
+
+namespace cc0
+{
+	/// @brief The statistics recorded for one operation of one fixed-point format: how often it ran, how far the fixed-point result drifted from the double shadow, and how large the widened intermediate grew.
+	struct fixed_traced_stats
+	{
+		const char         *op;                // The name of the operation.
+		uint32_t            bits;              // The total number of bits of the format.
+		uint32_t            precision;         // The number of bits dedicated to decimals of the format.
+		uint64_t            count;             // The number of times the operation ran.
+		double              max_abs_err;       // The largest absolute difference between the fixed-point value and the shadow.
+		double              max_rel_err;       // The largest relative difference between the fixed-point value and the shadow.
+		double              peak_intermediate; // The largest magnitude the widened intermediate reached, in raw bit-representation units. Its base-2 logarithm is the number of intermediate bits the operation actually needed.
+		fixed_traced_stats *next;              // The next entry in the registry.
+	};
+
+	/// @brief For internal use only.
+	namespace fixed_internal
+	{
+		/// @brief Accesses the head of the registry of traced statistics.
+		/// @return A reference to the head of the registry.
+		inline fixed_traced_stats *&traced_head( void )
+		{
+			static fixed_traced_stats *head = nullptr;
+			return head;
+		}
+
+		/// @brief The per-format block of traced statistics, one entry per operation, registered into the registry when the format is first used.
+		/// @tparam bits The number of bits of the format.
+		/// @tparam precision The number of bits dedicated to decimals of the format.
+		template < uint32_t bits, uint32_t precision >
+		struct traced_block
+		{
+			static constexpr uint32_t OPS = 5; // The number of traced operations.
+
+			fixed_traced_stats s[OPS]; // The statistics, indexed add, sub, mul, div, int.
+
+			/// @brief Initializes the block and links it into the registry.
+			traced_block( void )
+			{
+				static const char *const names[OPS] = { "add", "sub", "mul", "div", "int" };
+				for (uint32_t i = 0; i < OPS; ++i) {
+					s[i].op                = names[i];
+					s[i].bits              = bits;
+					s[i].precision         = precision;
+					s[i].count             = 0;
+					s[i].max_abs_err       = 0.0;
+					s[i].max_rel_err       = 0.0;
+					s[i].peak_intermediate = 0.0;
+					s[i].next              = traced_head();
+					traced_head()          = &s[i];
+				}
+			}
+		};
+
+		/// @brief Accesses the traced statistics of one operation of one format.
+		/// @tparam bits The number of bits of the format.
+		/// @tparam precision The number of bits dedicated to decimals of the format.
+		/// @param op The operation index; add, sub, mul, div, int in order.
+		/// @return A reference to the statistics.
+		template < uint32_t bits, uint32_t precision >
+		fixed_traced_stats &traced_stats(uint32_t op)
+		{
+			static traced_block<bits,precision> block;
+			return block.s[op];
+		}
+
+		/// @brief Records one traced operation.
+		/// @param s The statistics to record into.
+		/// @param value The value the fixed-point operation produced.
+		/// @param shadow The double shadow of the same operation.
+		/// @param intermediate The magnitude of the widened intermediate in raw bit-representation units.
+		inline void traced_record(fixed_traced_stats &s, double value, double shadow, double intermediate)
+		{
+			++s.count;
+			const double abs_err = std::fabs(value - shadow);
+			if (abs_err > s.max_abs_err) { s.max_abs_err = abs_err; }
+			if (std::fabs(shadow) > 1e-12 && abs_err / std::fabs(shadow) > s.max_rel_err) { s.max_rel_err = abs_err / std::fabs(shadow); }
+			if (intermediate > s.peak_intermediate) { s.peak_intermediate = intermediate; }
+		}
+	}
+
+	/// @brief Writes every recorded statistic to a stream, one line per format and operation, including the number of intermediate bits each operation actually needed. Reading the report after one instrumented run of a pipeline shows the smallest width and precision that meet its tolerance.
+	/// @param out The stream to write to.
+	inline void fixed_traced_dump(std::FILE *out)
+	{
+		for (const fixed_traced_stats *s = cc0::fixed_internal::traced_head(); s != nullptr; s = s->next) {
+			if (s->count == 0) { continue; }
+			std::fprintf(
+				out,
+				"fixed_traced<%u,%u> %s: calls=%llu max_abs_err=%.3e max_rel_err=%.3e intermediate_bits=%.1f\n",
+				s->bits, s->precision, s->op,
+				static_cast<unsigned long long>(s->count),
+				s->max_abs_err, s->max_rel_err,
+				s->peak_intermediate > 0.0 ? std::log2(s->peak_intermediate) : 0.0
+			);
+		}
+	}
+
+	/// @brief For internal use only.
+	namespace fixed_internal
+	{
+		/// @brief Writes the report to the standard error stream. For internal use by fixed_traced_dump_at_exit.
+		inline void traced_dump_stderr( void ) { cc0::fixed_traced_dump(stderr); }
+	}
+
+	/// @brief Arranges for the report to be written to the standard error stream when the program exits normally.
+	inline void fixed_traced_dump_at_exit( void )
+	{
+		static const int registered = std::atexit(&cc0::fixed_internal::traced_dump_stderr);
+		(void)registered;
+	}
+
+	/// @brief A fixed-point number that behaves exactly like the plain type but shadows every operation with a double reference value and records the drift and the widened intermediate magnitude per operation. Meant for one-off profiling runs, not production builds; the shadow doubles the storage and every operation pays the bookkeeping.
+	/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+	/// @tparam precision The number of bits dedicated to decimals.
+	template < uint32_t bits, uint32_t precision >
+	class fixed_traced
+	{
+	private:
+		typedef typename cc0::fixed_internal::intinfo<bits>::int_t       int_t;
+		typedef typename cc0::fixed_internal::intinfo<bits>::uint_t      uint_t;
+		typedef typename cc0::fixed_internal::intinfo<bits>::next::int_t wide_t;
+
+		static constexpr uint32_t ADD = 0, SUB = 1, MUL = 2, DIV = 3, INT = 4; // The operation indices in the traced block.
+
+		/// @brief The represented value as a double, for comparing against the shadow.
+		/// @return The represented value.
+		double v( void ) const { return double(value_bits) / double(uint64_t(1) << precision); }
+
+	public:
+		int_t  value_bits; // The binary representation of the fixed-point number, identical to what the plain type holds.
+		double shadow;     // The double reference value the same operations would have produced.
+
+		/// @brief The default constructor. Does nothing, and does not initialize the instance.
+		fixed_traced( void ) = default;
+
+		/// @brief The copy constructor.
+		/// @param NA The instance to copy.
+		fixed_traced(const fixed_traced&) = default;
+
+		/// @brief The copy operator.
+		/// @param NA The instance to copy.
+		/// @return The result.
+		fixed_traced &operator=(const fixed_traced&) = default;
+
+		/// @brief A conversion constructor that converts an integer into a fixed-point number by upscaling it.
+		/// @param n The number to upscale into a fixed-point number.
+		fixed_traced(int_t n) : value_bits(int_t(uint_t(n) << precision)), shadow(double(n)) {
+			cc0::fixed_internal::traced_record(cc0::fixed_internal::traced_stats<bits,precision>(INT), v(), shadow, std::fabs(double(n)) * double(uint64_t(1) << precision));
+		}
+
+		/// @brief Converts two integers into a fixed-point number. The shadow adopts the represented value, since the base-10 scaling is approximate by design and its error is not what this type profiles.
+		/// @param i The integer part of the number.
+		/// @param d The fractional part of the number in base 10.
+		/// @note The fractional parameter is scaled properly, meaning 9 is the same as 90, 900, 9000, etc.
+		fixed_traced(int_t i, uint_t d) : value_bits(cc0::fixed<bits,precision>(i, d).value_bits), shadow(0.0) { shadow = v(); }
+
+		/// @brief A conversion constructor adopting a plain fixed-point number, with the shadow set to its represented value.
+		/// @param f The fixed-point number.
+		explicit fixed_traced(cc0::fixed<bits,precision> f) : value_bits(f.value_bits), shadow(0.0) { shadow = v(); }
+
+		/// @brief A conversion operator converting the number into a plain fixed-point number, dropping the shadow.
+		operator cc0::fixed<bits,precision>( void ) const {
+			cc0::fixed<bits,precision> out;
+			out.value_bits = value_bits;
+			return out;
+		}
+
+		/// @brief A conversion operator converting the fixed-point number into an integer by downscaling it.
+		explicit operator int_t( void ) const { return value_bits >> precision; }
+
+		/// @brief Addition, recorded.
+		/// @param r The right-hand side operator.
+		/// @return The result.
+		fixed_traced &operator+=(fixed_traced r) {
+			const double inter = std::fabs(double(value_bits) + double(r.value_bits));
+			value_bits += r.value_bits;
+			shadow += r.shadow;
+			cc0::fixed_internal::traced_record(cc0::fixed_internal::traced_stats<bits,precision>(ADD), v(), shadow, inter);
+			return *this;
+		}
+
+		/// @brief Subtraction, recorded.
+		/// @param r The right-hand side operator.
+		/// @return The result.
+		fixed_traced &operator-=(fixed_traced r) {
+			const double inter = std::fabs(double(value_bits) - double(r.value_bits));
+			value_bits -= r.value_bits;
+			shadow -= r.shadow;
+			cc0::fixed_internal::traced_record(cc0::fixed_internal::traced_stats<bits,precision>(SUB), v(), shadow, inter);
+			return *this;
+		}
+
+		/// @brief Multiplication, recorded. The intermediate magnitude is the full product before the downscaling shift, i.e. what the widened type actually has to hold.
+		/// @param r The right-hand side operator.
+		/// @return The result.
+		fixed_traced &operator*=(fixed_traced r) {
+			const double inter = std::fabs(double(value_bits) * double(r.value_bits));
+			value_bits = int_t((wide_t(value_bits) * r.value_bits) >> precision);
+			shadow *= r.shadow;
+			cc0::fixed_internal::traced_record(cc0::fixed_internal::traced_stats<bits,precision>(MUL), v(), shadow, inter);
+			return *this;
+		}
+
+		/// @brief Division, recorded. The intermediate magnitude is the upscaled dividend, i.e. what the widened type actually has to hold.
+		/// @param r The right-hand side operator.
+		/// @return The result.
+		fixed_traced &operator/=(fixed_traced r) {
+			const double inter = std::fabs(double(value_bits)) * double(uint64_t(1) << precision);
+			value_bits = int_t((wide_t(value_bits) << precision) / r.value_bits);
+			shadow /= r.shadow;
+			cc0::fixed_internal::traced_record(cc0::fixed_internal::traced_stats<bits,precision>(DIV), v(), shadow, inter);
+			return *this;
+		}
+
+		/// @brief Pre-increment.
+		/// @return A reference to the state of the variable after increment.
+		fixed_traced &operator++( void ) { return *this += fixed_traced(int_t(1)); }
+
+		/// @brief Post-increment.
+		/// @return The state of the variable before increment.
+		fixed_traced operator++( int ) { auto t = *this; *this += fixed_traced(int_t(1)); return t; }
+
+		/// @brief Pre-decrement.
+		/// @return A reference to the state of the variable after decrement.
+		fixed_traced &operator--( void ) { return *this -= fixed_traced(int_t(1)); }
+
+		/// @brief Post-decrement.
+		/// @return The state of the variable before decrement.
+		fixed_traced operator--( int ) { auto t = *this; *this -= fixed_traced(int_t(1)); return t; }
+	};
+}
+
+/// @brief Addition.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline cc0::fixed_traced<bits,precision> operator+(cc0::fixed_traced<bits,precision> l, cc0::fixed_traced<bits,precision> r) { return l += r; }
+
+/// @brief Subtraction.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline cc0::fixed_traced<bits,precision> operator-(cc0::fixed_traced<bits,precision> l, cc0::fixed_traced<bits,precision> r) { return l -= r; }
+
+/// @brief Multiplication.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline cc0::fixed_traced<bits,precision> operator*(cc0::fixed_traced<bits,precision> l, cc0::fixed_traced<bits,precision> r) { return l *= r; }
+
+/// @brief Division.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline cc0::fixed_traced<bits,precision> operator/(cc0::fixed_traced<bits,precision> l, cc0::fixed_traced<bits,precision> r) { return l /= r; }
+
+/// @brief Equality.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline bool operator==(cc0::fixed_traced<bits,precision> l, cc0::fixed_traced<bits,precision> r) { return l.value_bits == r.value_bits; }
+
+/// @brief Inequality.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline bool operator!=(cc0::fixed_traced<bits,precision> l, cc0::fixed_traced<bits,precision> r) { return l.value_bits != r.value_bits; }
+
+/// @brief Less than.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline bool operator<(cc0::fixed_traced<bits,precision> l, cc0::fixed_traced<bits,precision> r) { return l.value_bits < r.value_bits; }
+
+/// @brief Greater than.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline bool operator>(cc0::fixed_traced<bits,precision> l, cc0::fixed_traced<bits,precision> r) { return l.value_bits > r.value_bits; }
+
+/// @brief Less or equal.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline bool operator<=(cc0::fixed_traced<bits,precision> l, cc0::fixed_traced<bits,precision> r) { return l.value_bits <= r.value_bits; }
+
+/// @brief Greater or equal.
+/// @tparam bits The total number of bits for the base data type. Supported sizes are 8, 16, 32, and 64.
+/// @tparam precision The number of bits dedicated to decimals.
+/// @param l The left-hand side operand.
+/// @param r The right-hand side operand.
+/// @return The result.
+template < uint32_t bits, uint32_t precision > inline bool operator>=(cc0::fixed_traced<bits,precision> l, cc0::fixed_traced<bits,precision> r) { return l.value_bits >= r.value_bits; }
+
+#endif
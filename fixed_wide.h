@@ -0,0 +1,328 @@
+/// @file fixed_wide.h
+/// @brief Contains a two-word 128-bit integer type built from 64-bit words and the intinfo trait specialization that lets fixed<128,precision> instantiate with the existing operator templates unchanged.
+/// @author github.com/SirJonthe
+/// @date 2025
+/// @copyright Public domain.
+/// @license CC0 1.0
+
+#ifndef CC0_FIXED_WIDE_H_INCLUDED__
+#define CC0_FIXED_WIDE_H_INCLUDED__
+
+#include <cstdint>
+
+#include "fixed.h"
+
+namespace cc0
+{
+	/// @brief For internal use only.
+	namespace fixed_internal
+	{
+		class int128;
+
+		/// @brief An unsigned 128-bit integer built from two 64-bit words. Supports the operations the fixed-point operator templates perform on their base type; addition and subtraction are one carry chain, multiplication is the school-book decomposition through the shared 64x64 high-half helper, and division is a restoring loop over the significant bits.
+		class uint128
+		{
+		public:
+			uint64_t lo; // The low 64 bits.
+			uint64_t hi; // The high 64 bits.
+
+			/// @brief The default constructor. Does nothing, and does not initialize the instance.
+			uint128( void ) = default;
+
+			/// @brief The copy constructor.
+			/// @param NA The instance to copy.
+			uint128(const uint128&) = default;
+
+			/// @brief The copy operator.
+			/// @param NA The instance to copy.
+			/// @return The result.
+			uint128 &operator=(const uint128&) = default;
+
+			/// @brief Constructs a number from its two words.
+			/// @param high The high 64 bits.
+			/// @param low The low 64 bits.
+			constexpr uint128(uint64_t high, uint64_t low) : lo(low), hi(high) {}
+
+			/// @brief A conversion constructor that zero-extends a 64-bit number.
+			/// @param n The number.
+			constexpr uint128(uint64_t n) : lo(n), hi(0) {}
+
+			/// @brief A conversion constructor adopting the bit pattern of a signed 128-bit number.
+			/// @param x The number.
+			explicit constexpr uint128(int128 x);
+
+			/// @brief A conversion operator truncating the number to its low 64 bits.
+			explicit constexpr operator uint64_t( void ) const { return lo; }
+
+			/// @brief A conversion operator truncating the number to a smaller signed type, as the format conversion helpers narrow through the unsigned wide type.
+			explicit constexpr operator int64_t( void ) const { return int64_t(lo); }
+
+			/// @brief A conversion operator truncating the number to a smaller signed type, as the format conversion helpers narrow through the unsigned wide type.
+			explicit constexpr operator int32_t( void ) const { return int32_t(lo); }
+
+			/// @brief A conversion operator truncating the number to a smaller signed type, as the format conversion helpers narrow through the unsigned wide type.
+			explicit constexpr operator int16_t( void ) const { return int16_t(lo); }
+
+			/// @brief A conversion operator truncating the number to a smaller signed type, as the format conversion helpers narrow through the unsigned wide type.
+			explicit constexpr operator int8_t( void ) const { return int8_t(lo); }
+
+			/// @brief Bitwise or.
+			/// @param r The right-hand side operand.
+			/// @return The result.
+			constexpr uint128 operator|(uint128 r) const { return uint128(hi | r.hi, lo | r.lo); }
+
+			/// @brief Bitwise and.
+			/// @param r The right-hand side operand.
+			/// @return The result.
+			constexpr uint128 operator&(uint128 r) const { return uint128(hi & r.hi, lo & r.lo); }
+
+			/// @brief Left shift.
+			/// @param s The number of bits to shift by. Must be between 0 and 127.
+			/// @return The result.
+			constexpr uint128 operator<<(uint32_t s) const {
+				return s == 0 ? *this : (s < 64 ? uint128((hi << s) | (lo >> (64 - s)), lo << s) : uint128(lo << (s - 64), 0));
+			}
+
+			/// @brief Right shift.
+			/// @param s The number of bits to shift by. Must be between 0 and 127.
+			/// @return The result.
+			constexpr uint128 operator>>(uint32_t s) const {
+				return s == 0 ? *this : (s < 64 ? uint128(hi >> s, (lo >> s) | (hi << (64 - s))) : uint128(0, hi >> (s - 64)));
+			}
+
+			/// @brief Addition. One carry propagates from the low word into the high word.
+			/// @param r The right-hand side operand.
+			/// @return The result.
+			constexpr uint128 operator+(uint128 r) const { return uint128(hi + r.hi + ((lo + r.lo) < lo ? 1 : 0), lo + r.lo); }
+
+			/// @brief Subtraction. One borrow propagates from the low word into the high word.
+			/// @param r The right-hand side operand.
+			/// @return The result.
+			constexpr uint128 operator-(uint128 r) const { return uint128(hi - r.hi - (lo < r.lo ? 1 : 0), lo - r.lo); }
+
+			/// @brief Multiplication, keeping the low 128 bits of the product. The school-book decomposition for a fixed two-word size is three 64-bit multiplies plus the shared high-half helper; splitting further buys nothing at this width.
+			/// @param r The right-hand side operand.
+			/// @return The result.
+			constexpr uint128 operator*(uint128 r) const { return uint128(umulhi(lo, r.lo) + lo * r.hi + hi * r.lo, lo * r.lo); }
+
+			/// @brief Division. A single 64-bit divide when both operands fit one word, otherwise a restoring loop over the significant bits of the dividend.
+			/// @param r The right-hand side operand. Must not be zero.
+			/// @return The result.
+			CC0_FIXED_CONSTEXPR uint128 operator/(uint128 r) const {
+				if (hi == 0 && r.hi == 0) { return uint128(0, lo / r.lo); }
+				uint128 q(0, 0);
+				uint128 rem(0, 0);
+				for (uint32_t i = (hi != 0 ? bit_width(hi) + 64 : bit_width(lo)); i-- > 0;) {
+					rem = rem << 1;
+					rem.lo |= (i < 64 ? lo >> i : hi >> (i - 64)) & 1;
+					if (!(rem < r)) {
+						rem = rem - r;
+						if (i < 64) { q.lo |= uint64_t(1) << i; } else { q.hi |= uint64_t(1) << (i - 64); }
+					}
+				}
+				return q;
+			}
+
+			/// @brief Equality.
+			/// @param r The right-hand side operand.
+			/// @return The result.
+			constexpr bool operator==(uint128 r) const { return hi == r.hi && lo == r.lo; }
+
+			/// @brief Inequality.
+			/// @param r The right-hand side operand.
+			/// @return The result.
+			constexpr bool operator!=(uint128 r) const { return hi != r.hi || lo != r.lo; }
+
+			/// @brief Less than.
+			/// @param r The right-hand side operand.
+			/// @return The result.
+			constexpr bool operator<(uint128 r) const { return hi < r.hi || (hi == r.hi && lo < r.lo); }
+
+			/// @brief Greater than.
+			/// @param r The right-hand side operand.
+			/// @return The result.
+			constexpr bool operator>(uint128 r) const { return r < *this; }
+
+			/// @brief Less or equal.
+			/// @param r The right-hand side operand.
+			/// @return The result.
+			constexpr bool operator<=(uint128 r) const { return !(r < *this); }
+
+			/// @brief Greater or equal.
+			/// @param r The right-hand side operand.
+			/// @return The result.
+			constexpr bool operator>=(uint128 r) const { return !(*this < r); }
+		};
+
+		/// @brief A signed two's complement 128-bit integer built from two 64-bit words. The bit-pattern operations are shared with the unsigned type since two's complement makes the low 128 bits of add, subtract, shift left, and multiply identical; only comparison, right shift, and division differ.
+		class int128
+		{
+		public:
+			uint64_t lo; // The low 64 bits.
+			int64_t  hi; // The high 64 bits, holding the sign.
+
+			/// @brief The default constructor. Does nothing, and does not initialize the instance.
+			int128( void ) = default;
+
+			/// @brief The copy constructor.
+			/// @param NA The instance to copy.
+			int128(const int128&) = default;
+
+			/// @brief The copy operator.
+			/// @param NA The instance to copy.
+			/// @return The result.
+			int128 &operator=(const int128&) = default;
+
+			/// @brief Constructs a number from its two words.
+			/// @param high The high 64 bits.
+			/// @param low The low 64 bits.
+			constexpr int128(int64_t high, uint64_t low) : lo(low), hi(high) {}
+
+			/// @brief A conversion constructor that sign-extends a 64-bit number.
+			/// @param n The number.
+			constexpr int128(int64_t n) : lo(uint64_t(n)), hi(n < 0 ? -1 : 0) {}
+
+			/// @brief A conversion constructor adopting the bit pattern of an unsigned 128-bit number.
+			/// @param x The number.
+			explicit constexpr int128(uint128 x) : lo(x.lo), hi(int64_t(x.hi)) {}
+
+			/// @brief A conversion operator truncating the number to its low 64 bits.
+			explicit constexpr operator int64_t( void ) const { return int64_t(lo); }
+
+			/// @brief Bitwise or.
+			/// @param r The right-hand side operand.
+			/// @return The result.
+			constexpr int128 operator|(int128 r) const { return int128(hi | r.hi, lo | r.lo); }
+
+			/// @brief Bitwise and.
+			/// @param r The right-hand side operand.
+			/// @return The result.
+			constexpr int128 operator&(int128 r) const { return int128(hi & r.hi, lo & r.lo); }
+
+			/// @brief Left shift.
+			/// @param s The number of bits to shift by. Must be between 0 and 127.
+			/// @return The result.
+			constexpr int128 operator<<(uint32_t s) const {
+				return s == 0 ? *this : (s < 64 ? int128(int64_t((uint64_t(hi) << s) | (lo >> (64 - s))), lo << s) : int128(int64_t(lo << (s - 64)), 0));
+			}
+
+			/// @brief Arithmetic right shift, preserving the sign.
+			/// @param s The number of bits to shift by. Must be between 0 and 127.
+			/// @return The result.
+			constexpr int128 operator>>(uint32_t s) const {
+				return s == 0 ? *this : (s < 64 ? int128(hi >> s, (lo >> s) | (uint64_t(hi) << (64 - s))) : int128(hi >> 63, uint64_t(hi >> (s - 64))));
+			}
+
+			/// @brief Addition. The carry chain runs in unsigned arithmetic so wrapping is well defined.
+			/// @param r The right-hand side operand.
+			/// @return The result.
+			constexpr int128 operator+(int128 r) const { return int128(int64_t(uint64_t(hi) + uint64_t(r.hi) + ((lo + r.lo) < lo ? 1 : 0)), lo + r.lo); }
+
+			/// @brief Subtraction. The borrow chain runs in unsigned arithmetic so wrapping is well defined.
+			/// @param r The right-hand side operand.
+			/// @return The result.
+			constexpr int128 operator-(int128 r) const { return int128(int64_t(uint64_t(hi) - uint64_t(r.hi) - (lo < r.lo ? 1 : 0)), lo - r.lo); }
+
+			/// @brief Negation.
+			/// @return The result.
+			constexpr int128 operator-( void ) const { return int128(0) - *this; }
+
+			/// @brief Multiplication, keeping the low 128 bits of the product, which two's complement makes identical to the unsigned product of the bit patterns.
+			/// @param r The right-hand side operand.
+			/// @return The result.
+			constexpr int128 operator*(int128 r) const { return int128(int64_t(umulhi(lo, r.lo) + lo * uint64_t(r.hi) + uint64_t(hi) * r.lo), lo * r.lo); }
+
+			/// @brief Division, truncating toward zero like the built-in integer types.
+			/// @param r The right-hand side operand. Must not be zero.
+			/// @return The result.
+			CC0_FIXED_CONSTEXPR int128 operator/(int128 r) const {
+				const uint128 q = uint128(hi < 0 ? -*this : *this) / uint128(r.hi < 0 ? -r : r);
+				return (hi < 0) != (r.hi < 0) ? -int128(q) : int128(q);
+			}
+
+			/// @brief Addition.
+			/// @param r The right-hand side operand.
+			/// @return The result.
+			CC0_FIXED_CONSTEXPR int128 &operator+=(int128 r) { return *this = *this + r; }
+
+			/// @brief Subtraction.
+			/// @param r The right-hand side operand.
+			/// @return The result.
+			CC0_FIXED_CONSTEXPR int128 &operator-=(int128 r) { return *this = *this - r; }
+
+			/// @brief Multiplication.
+			/// @param r The right-hand side operand.
+			/// @return The result.
+			CC0_FIXED_CONSTEXPR int128 &operator*=(int128 r) { return *this = *this * r; }
+
+			/// @brief Division.
+			/// @param r The right-hand side operand. Must not be zero.
+			/// @return The result.
+			CC0_FIXED_CONSTEXPR int128 &operator/=(int128 r) { return *this = *this / r; }
+
+			/// @brief Equality.
+			/// @param r The right-hand side operand.
+			/// @return The result.
+			constexpr bool operator==(int128 r) const { return hi == r.hi && lo == r.lo; }
+
+			/// @brief Inequality.
+			/// @param r The right-hand side operand.
+			/// @return The result.
+			constexpr bool operator!=(int128 r) const { return hi != r.hi || lo != r.lo; }
+
+			/// @brief Less than.
+			/// @param r The right-hand side operand.
+			/// @return The result.
+			constexpr bool operator<(int128 r) const { return hi < r.hi || (hi == r.hi && lo < r.lo); }
+
+			/// @brief Greater than.
+			/// @param r The right-hand side operand.
+			/// @return The result.
+			constexpr bool operator>(int128 r) const { return r < *this; }
+
+			/// @brief Less or equal.
+			/// @param r The right-hand side operand.
+			/// @return The result.
+			constexpr bool operator<=(int128 r) const { return !(r < *this); }
+
+			/// @brief Greater or equal.
+			/// @param r The right-hand side operand.
+			/// @return The result.
+			constexpr bool operator>=(int128 r) const { return !(*this < r); }
+		};
+
+		constexpr uint128::uint128(int128 x) : lo(x.lo), hi(uint64_t(x.hi)) {}
+
+		/// @brief Provides some type information for the two-word 128-bit integer types.
+		template <>
+		struct intinfo<128>
+		{
+			typedef int128       int_t;  // An 128-bit signed type built from two 64-bit words.
+			typedef uint128      uint_t; // An 128-bit unsigned type built from two 64-bit words.
+			typedef intinfo<64>  prev;   // The previous, smaller type info object for when casting to the previous smaller type is needed.
+			typedef intinfo<128> next;   // The next, larger type info object (there is none, so we alias the same object).
+		};
+
+		/// @brief Compile-time constants and helpers used to scale a base-10 fraction into the binary representation of a 128-bit fixed-point number. The fraction is scaled with the 64-bit machinery at the widest precision it handles and shifted into the remaining bits, since a base-10 fraction parameter never carries more significant digits than 64 bits hold.
+		/// @tparam precision The number of bits dedicated to decimals.
+		template < uint32_t precision >
+		struct frac_scale<128, precision>
+		{
+			typedef intinfo<128>::int_t  int_t;
+			typedef intinfo<128>::uint_t uint_t;
+
+			static constexpr uint32_t LOW_PRECISION = precision < 36 ? precision : 36; // The widest precision at which the 64-bit scaler's 32-bit base-10 constants stay exact.
+
+			/// @brief Converts a base-10 fraction into fractional bits.
+			/// @param d The fractional part of the number in base 10.
+			/// @return The fractional bits.
+			/// @note The fractional parameter is scaled properly, meaning 9 is the same as 90, 900, 9000, etc.
+			static constexpr int_t frac_bits(uint_t d)
+			{
+				return int_t(uint128(uint64_t(frac_scale<64,LOW_PRECISION>::frac_bits(uint64_t(d)))) << (precision - LOW_PRECISION));
+			}
+		};
+	}
+}
+
+#endif